@@ -1473,7 +1473,7 @@ void DocAccessible::ProcessQueuedCacheUpdates() {
                             {}, ""_ns);
   // DO NOT ADD CODE ABOVE THIS BLOCK: THIS CODE IS MEASURING TIMINGS.
 
-  nsTArray<CacheData> data;
+  nsTArray<CacheData> data(mQueuedCacheUpdates.Count());
   for (auto iter = mQueuedCacheUpdates.Iter(); !iter.Done(); iter.Next()) {
     LocalAccessible* acc = iter.Key();
     uint64_t domain = iter.UserData();
@@ -120,6 +120,10 @@ class AttrArray {
   // unmapped attributes of |aOther|.
   nsresult EnsureCapacityToClone(const AttrArray& aOther);
 
+  // Increases capacity (if necessary) to exactly aCount attributes, for
+  // callers that know upfront how many attributes they are going to set.
+  nsresult EnsureCapacity(uint32_t aCount);
+
   enum AttrValuesState { ATTR_MISSING = -1, ATTR_VALUE_NO_MATCH = -2 };
   using AttrValuesArray = nsStaticAtom* const;
   int32_t FindAttrValueIn(int32_t aNameSpaceID, const nsAtom* aName,
@@ -188,6 +192,7 @@ class AttrArray {
   nsresult MakeMappedUnique(nsMappedAttributes* aAttributes);
 
   bool GrowBy(uint32_t aGrowSize);
+  bool SetCapacity(uint32_t aCapacity);
 
   // Tries to create an attribute, growing the buffer if needed, with the given
   // name and value.
@@ -6,11 +6,13 @@
 
 #include "BodyStream.h"
 #include "js/GCAPI.h"
+#include "js/experimental/TypedData.h"
 #include "mozilla/CycleCollectedJSContext.h"
 #include "mozilla/dom/AutoEntryScript.h"
 #include "mozilla/dom/DOMException.h"
 #include "mozilla/dom/ReadableStream.h"
 #include "mozilla/dom/ReadableByteStreamController.h"
+#include "mozilla/dom/ReadableStreamBYOBRequest.h"
 #include "mozilla/dom/ScriptSettings.h"
 #include "mozilla/dom/WorkerCommon.h"
 #include "mozilla/dom/WorkerPrivate.h"
@@ -390,6 +392,37 @@ void BodyStream::EnqueueChunkWithSizeIntoStream(JSContext* aCx,
   uint32_t ableToRead =
       std::min(static_cast<uint64_t>(256 * 1024 * 1024), aAvailableData);
 
+  MOZ_ASSERT(aStream->Controller()->IsByte());
+  RefPtr<ReadableByteStreamController> byteStreamController =
+      aStream->Controller()->AsByte();
+
+  // If a BYOB reader is waiting for data, read straight into its buffer
+  // rather than into a new chunk that the controller would then copy over.
+  RefPtr<ReadableStreamBYOBRequest> byobRequest =
+      ReadableByteStreamControllerGetBYOBRequest(aCx, byteStreamController,
+                                                 aRv);
+  if (aRv.Failed()) {
+    return;
+  }
+  if (byobRequest) {
+    JS::Rooted<JSObject*> view(aCx);
+    byobRequest->GetView(aCx, &view);
+    size_t viewLength = view ? JS_GetArrayBufferViewByteLength(view) : 0;
+    if (viewLength) {
+      uint32_t bytesWritten = 0;
+      WriteIntoReadRequestBuffer(aCx, aStream, view,
+                                 std::min(size_t(ableToRead), viewLength),
+                                 &bytesWritten);
+      if (bytesWritten == 0) {
+        return;
+      }
+
+      ReadableByteStreamControllerRespond(aCx, byteStreamController,
+                                          bytesWritten, aRv);
+      return;
+    }
+  }
+
   // Create Chunk
   aRv.MightThrowJSException();
   JS::Rooted<JSObject*> chunk(aCx, JS_NewUint8Array(aCx, ableToRead));
@@ -415,10 +448,6 @@ void BodyStream::EnqueueChunkWithSizeIntoStream(JSContext* aCx,
     MOZ_DIAGNOSTIC_ASSERT((ableToRead - bytesWritten) == 0);
   }
 
-  MOZ_ASSERT(aStream->Controller()->IsByte());
-  RefPtr<ReadableByteStreamController> byteStreamController =
-      aStream->Controller()->AsByte();
-
   ReadableByteStreamControllerEnqueue(aCx, byteStreamController, chunk, aRv);
   if (aRv.Failed()) {
     return;
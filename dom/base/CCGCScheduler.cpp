@@ -263,6 +263,11 @@ void CCGCScheduler::NoteGCSliceEnd(TimeStamp aStart, TimeStamp aEnd) {
       // Overran the idle deadline.
       nonIdleDuration = aEnd - *mTriggeredGCDeadline;
     }
+
+    // Keep a moving average of how far idle slices overrun their deadline so
+    // that later budgets can leave room for it.
+    mIdleGCSliceOverrun =
+        (mIdleGCSliceOverrun * 3 + nonIdleDuration).MultDouble(0.25);
   }
 
   PerfStats::RecordMeasurement(PerfStats::Metric::NonIdleMajorGC,
@@ -773,8 +778,18 @@ js::SliceBudget CCGCScheduler::ComputeInterSliceGCBudget(TimeStamp aDeadline,
   // tried to run since that means we may have a significant amount of
   // garbage to collect and it's better to GC in several longer slices than
   // in a very long one.
-  TimeDuration budget =
-      aDeadline.IsNull() ? mActiveIntersliceGCBudget * 2 : aDeadline - aNow;
+  TimeDuration budget;
+  if (aDeadline.IsNull()) {
+    budget = mActiveIntersliceGCBudget * 2;
+  } else {
+    // Recent idle slices have tended to run past their deadline by
+    // mIdleGCSliceOverrun (slices can't be interrupted at arbitrary points),
+    // so aim to finish that much earlier. Never give up more than half of
+    // the idle time to this.
+    TimeDuration idleTime = aDeadline - aNow;
+    budget =
+        std::max(idleTime - mIdleGCSliceOverrun, idleTime.MultDouble(0.5));
+  }
   if (!mCCBlockStart) {
     return CreateGCSliceBudget(budget, !aDeadline.IsNull(), false);
   }
@@ -514,6 +514,9 @@ class CCGCScheduler {
   // internally-triggered slice.
   mozilla::Maybe<TimeStamp> mTriggeredGCDeadline;
 
+  // Moving average of how long idle GC slices have run past their deadline.
+  TimeDuration mIdleGCSliceOverrun;
+
   RefPtr<IdleTaskRunner> mGCRunner;
   RefPtr<IdleTaskRunner> mCCRunner;
   nsITimer* mShrinkingGCTimer = nullptr;
@@ -833,6 +833,14 @@ class Element : public FragmentOrElement {
    */
   nsresult SetSingleClassFromParser(nsAtom* aSingleClassName);
 
+  /**
+   * Makes room for aCount attributes upfront, so that a parser setting a
+   * known number of attributes on a new element allocates exactly once.
+   */
+  nsresult EnsureAttrCapacity(uint32_t aCount) {
+    return mAttrs.EnsureCapacity(aCount);
+  }
+
   // aParsedValue receives the old value of the attribute. That's useful if
   // either the input or output value of aParsedValue is StoresOwnData.
   nsresult SetParsedAttr(int32_t aNameSpaceID, nsAtom* aName, nsAtom* aPrefix,
@@ -8,6 +8,7 @@
 #include "SourceSurfaceWebgl.h"
 
 #include "mozilla/ClearOnShutdown.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/StaticPrefs_gfx.h"
 #include "mozilla/gfx/Blur.h"
 #include "mozilla/gfx/DrawTargetSkia.h"
@@ -22,6 +23,7 @@
 #include "WebGLChild.h"
 
 #include "gfxPlatform.h"
+#include "nsPrintfCString.h"
 
 namespace mozilla::gfx {
 
@@ -3689,6 +3691,15 @@ void DrawTargetWebgl::UsageProfile::EndFrame() {
     ++mFailedFrames;
   }
   ++mFrameCount;
+
+  if (profiler_thread_is_being_profiled_for_markers()) {
+    PROFILER_MARKER_TEXT(
+        "DrawTargetWebgl frame", GRAPHICS, {},
+        nsPrintfCString("%s: fallbacks %u, readbacks %u, layers %u, cache "
+                        "hits %u, cache misses %u, uncached draws %u",
+                        failed ? "failed" : "ok", mFallbacks, mReadbacks,
+                        mLayers, mCacheHits, mCacheMisses, mUncachedDraws));
+  }
 }
 
 bool DrawTargetWebgl::UsageProfile::RequiresRefresh() const {
@@ -1758,6 +1758,9 @@ class ConnectionPool::TransactionInfo final {
   const nsTArray<nsString> mObjectStoreNames;
   nsTHashSet<TransactionInfo*> mBlockedOn;
   nsTArray<nsCOMPtr<nsIRunnable>> mQueuedRunnables;
+  // When the transaction was started, to report how long it was queued
+  // behind other transactions before it could run.
+  const TimeStamp mStartTime;
   const bool mIsWriteTransaction;
   bool mRunning;
 
@@ -4392,6 +4395,10 @@ class CursorBase : public PBackgroundIDBCursorParent {
 
   const int32_t mMaxExtraCount;
 
+  // The number of extra records to preload for the next basic continue
+  // operation, see AdaptMaxExtraCount. Only used on the background thread.
+  int32_t mAdaptiveMaxExtraCount;
+
   const bool mIsSameProcessActor;
 
   struct ConstructFromTransactionBase {};
@@ -4409,6 +4416,11 @@ class CursorBase : public PBackgroundIDBCursorParent {
   // Reference counted.
   ~CursorBase() override { MOZ_ASSERT(!mObjectStoreMetadata); }
 
+  // Returns the number of extra records to preload for a continue operation
+  // with aParams, growing it while the consumer keeps iterating one record at
+  // a time.
+  int32_t AdaptMaxExtraCount(const CursorRequestParams& aParams);
+
  private:
   virtual bool Start(const OpenCursorParams& aParams) = 0;
 };
@@ -4830,10 +4842,11 @@ class Cursor<CursorType>::ContinueOp final
 
   // Only created by Cursor.
   ContinueOp(Cursor* const aCursor, CursorRequestParams aParams,
-             CursorPosition<CursorType> aPosition)
+             CursorPosition<CursorType> aPosition, int32_t aMaxExtraCount)
       : CursorOpBase(aCursor),
         mParams(std::move(aParams)),
-        mCurrentPosition{std::move(aPosition)} {
+        mCurrentPosition{std::move(aPosition)},
+        mMaxExtraCount(aMaxExtraCount) {
     MOZ_ASSERT(mParams.type() != CursorRequestParams::T__None);
   }
 
@@ -4843,6 +4856,7 @@ class Cursor<CursorType>::ContinueOp final
   nsresult DoDatabaseWork(DatabaseConnection* aConnection) override;
 
   const CursorPosition<CursorType> mCurrentPosition;
+  const int32_t mMaxExtraCount;
 };
 
 class Utils final : public PBackgroundIndexedDBUtilsParent {
@@ -8415,6 +8429,12 @@ bool ConnectionPool::ScheduleTransaction(TransactionInfo& aTransactionInfo,
   MOZ_ASSERT(!aTransactionInfo.mRunning);
   aTransactionInfo.mRunning = true;
 
+  IDB_LOG_MARK_PARENT_TRANSACTION(
+      "Scheduled after %.1f ms", "Scheduled (%.1f ms)",
+      IDB_LOG_ID_STRING(aTransactionInfo.mBackgroundChildLoggingId),
+      aTransactionInfo.mLoggingSerialNumber,
+      (TimeStamp::NowLoRes() - aTransactionInfo.mStartTime).ToMilliseconds());
+
   nsTArray<nsCOMPtr<nsIRunnable>>& queuedRunnables =
       aTransactionInfo.mQueuedRunnables;
 
@@ -9073,6 +9093,7 @@ ConnectionPool::TransactionInfo::TransactionInfo(
       mTransactionId(aTransactionId),
       mLoggingSerialNumber(aLoggingSerialNumber),
       mObjectStoreNames(aObjectStoreNames.Clone()),
+      mStartTime(TimeStamp::NowLoRes()),
       mIsWriteTransaction(aIsWriteTransaction),
       mRunning(false) {
   AssertIsOnBackgroundThread();
@@ -11782,6 +11803,7 @@ CursorBase::CursorBase(SafeRefPtr<TransactionBase> aTransaction,
       mObjectStoreId((*mObjectStoreMetadata)->mCommonMetadata.id()),
       mDirection(aDirection),
       mMaxExtraCount(IndexedDatabaseManager::MaxPreloadExtraRecords()),
+      mAdaptiveMaxExtraCount(mMaxExtraCount),
       mIsSameProcessActor(!BackgroundParent::IsOtherProcessActor(
           mTransaction->GetBackgroundParent())) {
   AssertIsOnBackgroundThread();
@@ -11792,6 +11814,37 @@ CursorBase::CursorBase(SafeRefPtr<TransactionBase> aTransaction,
       "Lots of code here assumes only four types of cursors!");
 }
 
+int32_t CursorBase::AdaptMaxExtraCount(const CursorRequestParams& aParams) {
+  AssertIsOnBackgroundThread();
+
+  // Never grow the batch beyond this multiple of the configured preload count.
+  // The response size limit in PopulateExtraResponses still applies on top.
+  static constexpr int32_t kMaxPreloadGrowthFactor = 16;
+
+  const bool isBasicOperation =
+      (aParams.type() == CursorRequestParams::TContinueParams &&
+       aParams.get_ContinueParams().key().IsUnset()) ||
+      (aParams.type() == CursorRequestParams::TAdvanceParams &&
+       aParams.get_AdvanceParams().count() == 1);
+
+  if (!isBasicOperation) {
+    // The consumer is skipping ahead, so the records preloaded so far were
+    // most likely wasted. Start over with the configured count.
+    mAdaptiveMaxExtraCount = mMaxExtraCount;
+    return mAdaptiveMaxExtraCount;
+  }
+
+  // The child only sends a basic operation once it has consumed all records
+  // that were preloaded by the previous response, so double the batch size to
+  // save round trips for long sequential scans.
+  const int64_t maxCount =
+      std::min(int64_t(mMaxExtraCount) * kMaxPreloadGrowthFactor,
+               int64_t(INT32_MAX));
+  mAdaptiveMaxExtraCount =
+      int32_t(std::min(int64_t(mAdaptiveMaxExtraCount) * 2, maxCount));
+  return mAdaptiveMaxExtraCount;
+}
+
 template <IDBCursorType CursorType>
 bool Cursor<CursorType>::VerifyRequestParams(
     const CursorRequestParams& aParams,
@@ -12099,7 +12152,8 @@ mozilla::ipc::IPCResult Cursor<CursorType>::RecvContinue(
   }
 
   const RefPtr<ContinueOp> continueOp =
-      new ContinueOp(this, aParams, std::move(position));
+      new ContinueOp(this, aParams, std::move(position),
+                     this->AdaptMaxExtraCount(aParams));
   if (NS_WARN_IF(!continueOp->Init(*mTransaction))) {
     continueOp->Cleanup();
     return IPC_FAIL(this, "ContinueOp initialization failed!");
@@ -21241,7 +21295,7 @@ nsresult Cursor<CursorType>::ContinueOp::DoDatabaseWork(
   // preload only for an assumed basic operation. Other operations would require
   // more work on the client side for invalidation, and may not make any sense
   // at all.
-  const uint32_t maxExtraCount = hasContinueKey ? 0 : mCursor->mMaxExtraCount;
+  const uint32_t maxExtraCount = hasContinueKey ? 0 : mMaxExtraCount;
 
   QM_TRY_INSPECT(const auto& stmt,
                  aConnection->BorrowCachedStatement(
@@ -21250,7 +21304,7 @@ nsresult Cursor<CursorType>::ContinueOp::DoDatabaseWork(
 
   QM_TRY(MOZ_TO_RESULT(stmt->BindUTF8StringByName(
       kStmtParamNameLimit,
-      IntToCString(advanceCount + mCursor->mMaxExtraCount))));
+      IntToCString(advanceCount + maxExtraCount))));
 
   QM_TRY(MOZ_TO_RESULT(stmt->BindInt64ByName(kStmtParamNameId, mCursor->Id())));
 
@@ -11,6 +11,30 @@
 
 namespace mozilla::dom::indexedDB {
 
+namespace {
+
+struct AppendToStructuredCloneDataClosure {
+  JSStructuredCloneData& mData;
+  bool mOutOfMemory = false;
+};
+
+nsresult AppendToStructuredCloneData(nsIInputStream* aInputStream,
+                                     void* aClosure, const char* aFromSegment,
+                                     uint32_t aToOffset, uint32_t aCount,
+                                     uint32_t* aWriteCount) {
+  auto& closure = *static_cast<AppendToStructuredCloneDataClosure*>(aClosure);
+
+  if (!closure.mData.AppendBytes(aFromSegment, aCount)) {
+    closure.mOutOfMemory = true;
+    return NS_ERROR_OUT_OF_MEMORY;
+  }
+
+  *aWriteCount = aCount;
+  return NS_OK;
+}
+
+}  // namespace
+
 // aStructuredCloneData is a parameter rather than a return value because one
 // caller preallocates it on the heap not immediately before calling for some
 // reason. Maybe this could be changed.
@@ -19,21 +43,27 @@ nsresult SnappyUncompressStructuredCloneData(
   const auto snappyInputStream =
       MakeRefPtr<SnappyUncompressInputStream>(&aInputStream);
 
-  char buffer[kFileCopyBufferSize];
+  // Append the uncompressed chunks straight from the stream's buffer, rather
+  // than copying them through an intermediate buffer first. This matters for
+  // large values, which are read chunk by chunk.
+  AppendToStructuredCloneDataClosure closure{aStructuredCloneData};
 
   QM_TRY(CollectEach(
-      [&snappyInputStream = *snappyInputStream, &buffer] {
-        QM_TRY_RETURN(MOZ_TO_RESULT_INVOKE_MEMBER(snappyInputStream, Read,
-                                                  buffer, sizeof(buffer)));
+      [&snappyInputStream = *snappyInputStream, &closure] {
+        QM_TRY_RETURN(MOZ_TO_RESULT_INVOKE_MEMBER(
+            snappyInputStream, ReadSegments, AppendToStructuredCloneData,
+            &closure, kFileCopyBufferSize));
       },
-      [&aStructuredCloneData,
-       &buffer](const uint32_t& numRead) -> Result<Ok, nsresult> {
-        QM_TRY(OkIf(aStructuredCloneData.AppendBytes(buffer, numRead)),
-               Err(NS_ERROR_OUT_OF_MEMORY));
+      [&closure](const uint32_t&) -> Result<Ok, nsresult> {
+        QM_TRY(OkIf(!closure.mOutOfMemory), Err(NS_ERROR_OUT_OF_MEMORY));
 
         return Ok{};
       }));
 
+  // ReadSegments doesn't propagate writer errors and reports the bytes
+  // written so far, so a failed final append needs to be caught here.
+  QM_TRY(OkIf(!closure.mOutOfMemory), NS_ERROR_OUT_OF_MEMORY);
+
   return NS_OK;
 }
 
@@ -4742,6 +4742,9 @@ void Datastore::GetSnapshotLoadInfo(const nsAString& aKey,
       //      should be sent for each turn of the event loop but can be
       //      overridden when `aKey` is found.
 
+      // Every key is sent, so the final length is known upfront.
+      aItemInfos.SetCapacity(aItemInfos.Length() + mOrderedItems.Length());
+
       int64_t size = mSizeOfKeys;
       bool setVoidValue = false;
       bool doneSendingValues = false;
@@ -14,6 +14,7 @@
 #ifdef USE_SSE2
 #  include "mozilla/SSE.h"
 #  include "AlignmentUtils.h"
+#  include "AudioNodeEngineAVX2.h"
 #  include "AudioNodeEngineSSE2.h"
 #endif
 #include "AudioBlock.h"
@@ -93,7 +94,11 @@ void AudioBufferAddWithScale(const float* aInput, float aScale, float* aOutput,
     // we need to round aSize down to the nearest multiple of 16
     uint32_t alignedSize = aSize & ~0x0F;
     if (alignedSize > 0) {
-      AudioBufferAddWithScale_SSE(aInput, aScale, aOutput, alignedSize);
+      if (mozilla::supports_avx2()) {
+        AudioBufferAddWithScale_AVX2(aInput, aScale, aOutput, alignedSize);
+      } else {
+        AudioBufferAddWithScale_SSE(aInput, aScale, aOutput, alignedSize);
+      }
 
       // adjust parameters for use with scalar operations below
       aInput += alignedSize;
@@ -148,6 +153,10 @@ void AudioBlockCopyChannelWithScale(const float* aInput, float aScale,
 void BufferComplexMultiply(const float* aInput, const float* aScale,
                            float* aOutput, uint32_t aSize) {
 #ifdef USE_SSE2
+  if (mozilla::supports_avx2()) {
+    BufferComplexMultiply_AVX2(aInput, aScale, aOutput, aSize);
+    return;
+  }
   if (mozilla::supports_sse()) {
     BufferComplexMultiply_SSE(aInput, aScale, aOutput, aSize);
     return;
@@ -0,0 +1,69 @@
+/* -*- mode: c++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* this source code form is subject to the terms of the mozilla public
+ * license, v. 2.0. if a copy of the mpl was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "AudioNodeEngineAVX2.h"
+#include "AlignmentUtils.h"
+#include <immintrin.h>
+
+// These take the same arguments as their SSE counterparts, which only
+// guarantee 16 byte alignment, so unaligned loads and stores are used. No FMA
+// is used either, so that the results are identical to the SSE versions.
+
+namespace mozilla {
+void AudioBufferAddWithScale_AVX2(const float* aInput, float aScale,
+                                  float* aOutput, uint32_t aSize) {
+  __m256 vin0, vin1, vout0, vout1;
+
+  ASSERT_ALIGNED16(aInput);
+  ASSERT_ALIGNED16(aOutput);
+  ASSERT_MULTIPLE16(aSize);
+
+  __m256 vgain = _mm256_set1_ps(aScale);
+
+  for (unsigned i = 0; i < aSize; i += 16) {
+    vin0 = _mm256_mul_ps(_mm256_loadu_ps(&aInput[i]), vgain);
+    vin1 = _mm256_mul_ps(_mm256_loadu_ps(&aInput[i + 8]), vgain);
+
+    vout0 = _mm256_add_ps(_mm256_loadu_ps(&aOutput[i]), vin0);
+    vout1 = _mm256_add_ps(_mm256_loadu_ps(&aOutput[i + 8]), vin1);
+
+    _mm256_storeu_ps(&aOutput[i], vout0);
+    _mm256_storeu_ps(&aOutput[i + 8], vout1);
+  }
+}
+
+void BufferComplexMultiply_AVX2(const float* aInput, const float* aScale,
+                                float* aOutput, uint32_t aSize) {
+  __m256 in0, in1, real1, imag1, real2, imag2, outreal, outimag;
+
+  ASSERT_ALIGNED16(aInput);
+  ASSERT_ALIGNED16(aScale);
+  ASSERT_ALIGNED16(aOutput);
+  ASSERT_MULTIPLE16(aSize);
+
+  for (unsigned i = 0; i < aSize * 2; i += 16) {
+    // The shuffles work within 128-bit lanes, so each lane deinterleaves
+    // its own pairs of complex numbers, and the unpacks below put them back
+    // in their original order.
+    in0 = _mm256_loadu_ps(&aInput[i]);
+    in1 = _mm256_loadu_ps(&aInput[i + 8]);
+    real1 = _mm256_shuffle_ps(in0, in1, _MM_SHUFFLE(2, 0, 2, 0));
+    imag1 = _mm256_shuffle_ps(in0, in1, _MM_SHUFFLE(3, 1, 3, 1));
+
+    in0 = _mm256_loadu_ps(&aScale[i]);
+    in1 = _mm256_loadu_ps(&aScale[i + 8]);
+    real2 = _mm256_shuffle_ps(in0, in1, _MM_SHUFFLE(2, 0, 2, 0));
+    imag2 = _mm256_shuffle_ps(in0, in1, _MM_SHUFFLE(3, 1, 3, 1));
+
+    outreal =
+        _mm256_sub_ps(_mm256_mul_ps(real1, real2), _mm256_mul_ps(imag1, imag2));
+    outimag =
+        _mm256_add_ps(_mm256_mul_ps(real1, imag2), _mm256_mul_ps(imag1, real2));
+
+    _mm256_storeu_ps(&aOutput[i], _mm256_unpacklo_ps(outreal, outimag));
+    _mm256_storeu_ps(&aOutput[i + 8], _mm256_unpackhi_ps(outreal, outimag));
+  }
+}
+}  // namespace mozilla
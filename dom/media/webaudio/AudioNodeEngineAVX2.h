@@ -0,0 +1,14 @@
+/* -*- mode: c++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* this source code form is subject to the terms of the mozilla public
+ * license, v. 2.0. if a copy of the mpl was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "AudioNodeEngine.h"
+
+namespace mozilla {
+void AudioBufferAddWithScale_AVX2(const float* aInput, float aScale,
+                                  float* aOutput, uint32_t aSize);
+
+void BufferComplexMultiply_AVX2(const float* aInput, const float* aScale,
+                                float* aOutput, uint32_t aSize);
+}  // namespace mozilla
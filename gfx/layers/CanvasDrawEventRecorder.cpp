@@ -8,7 +8,9 @@
 
 #include <string.h>
 
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/layers/SharedSurfacesChild.h"
+#include "nsPrintfCString.h"
 #include "nsThreadUtils.h"
 
 namespace mozilla {
@@ -401,6 +403,13 @@ bool CanvasEventRingBuffer::WaitForReadCount(uint32_t aReadCount,
   mWrite->requiredDifference = requiredDifference;
   mWrite->state = State::Waiting;
 
+  // Recording is now blocked until the translator catches up, either to free
+  // space in the buffer or to reach a checkpoint. Mark how long for, to make
+  // this backpressure visible.
+  AUTO_PROFILER_MARKER_TEXT("CanvasEventRingBuffer writer wait", GRAPHICS, {},
+                            nsPrintfCString("%u bytes behind",
+                                            mOurCount - mRead->count));
+
   // Wait unless we detect the reading side has closed.
   while (!mWriterServices->ReaderClosed() && mRead->state != State::Failed) {
     if (mWriterSemaphore->Wait(Some(aTimeout))) {
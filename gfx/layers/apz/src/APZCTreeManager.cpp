@@ -39,6 +39,7 @@
 #include "mozilla/MouseEvents.h"
 #include "mozilla/mozalloc.h"     // for operator new
 #include "mozilla/Preferences.h"  // for Preferences
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/StaticPrefs_accessibility.h"
 #include "mozilla/StaticPrefs_apz.h"
 #include "mozilla/StaticPrefs_layout.h"
@@ -2819,6 +2820,7 @@ already_AddRefed<HitTestingTreeNode> APZCTreeManager::GetTargetNode(
 
 APZCTreeManager::HitTestResult APZCTreeManager::GetTargetAPZC(
     const ScreenPoint& aPoint) {
+  AUTO_PROFILER_MARKER_TEXT("APZ hit test", GRAPHICS, {}, ""_ns);
   RecursiveMutexAutoLock lock(mTreeLock);
   MOZ_ASSERT(mHitTester);
   return mHitTester->GetAPZCAtPoint(aPoint, lock);
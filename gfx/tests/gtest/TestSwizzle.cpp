@@ -5,7 +5,9 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"
 #include "mozilla/ArrayUtils.h"
+#include "mozilla/UniquePtr.h"
 #include "mozilla/gfx/Swizzle.h"
 #include "Orientation.h"
 
@@ -82,6 +84,58 @@ TEST(Moz2D, PremultiplyRow)
   EXPECT_TRUE(ArrayEqual(out, check_argb));
 }
 
+TEST(Moz2D, PremultiplyRowLong)
+{
+  // Long enough to cover the 8 pixel vector paths as well as the remainder.
+  const size_t kPixels = 19;
+  const uint8_t pattern_bgra[5 * 4] = {
+      255, 255, 0,   255, 0, 0, 255, 255, 0,   255,
+      255, 0,   0,   0,   0, 0, 255, 0,   0,   128,
+  };
+  const uint8_t pattern_check_bgra[5 * 4] = {
+      255, 255, 0, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 128,
+  };
+  const uint8_t pattern_check_rgba[5 * 4] = {
+      0, 255, 255, 255, 255, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128,
+  };
+  uint8_t in_bgra[kPixels * 4];
+  uint8_t check_bgra[kPixels * 4];
+  uint8_t check_rgba[kPixels * 4];
+  for (size_t i = 0; i < sizeof(in_bgra); i++) {
+    in_bgra[i] = pattern_bgra[i % sizeof(pattern_bgra)];
+    check_bgra[i] = pattern_check_bgra[i % sizeof(pattern_check_bgra)];
+    check_rgba[i] = pattern_check_rgba[i % sizeof(pattern_check_rgba)];
+  }
+  uint8_t out[kPixels * 4];
+
+  SwizzleRowFn func =
+      PremultiplyRow(SurfaceFormat::B8G8R8A8, SurfaceFormat::B8G8R8A8);
+  func(in_bgra, out, kPixels);
+  EXPECT_TRUE(ArrayEqual(out, check_bgra));
+
+  func = PremultiplyRow(SurfaceFormat::B8G8R8A8, SurfaceFormat::R8G8B8A8);
+  func(in_bgra, out, kPixels);
+  EXPECT_TRUE(ArrayEqual(out, check_rgba));
+
+  PremultiplyData(in_bgra, sizeof(in_bgra), SurfaceFormat::B8G8R8A8, out,
+                  sizeof(in_bgra), SurfaceFormat::B8G8R8A8,
+                  IntSize(kPixels, 1));
+  EXPECT_TRUE(ArrayEqual(out, check_bgra));
+}
+
+MOZ_GTEST_BENCH(Moz2D, PerfPremultiplyData, [] {
+  const IntSize size(1024, 1024);
+  const int32_t stride = size.width * 4;
+  auto data = MakeUnique<uint8_t[]>(stride * size.height);
+  for (int32_t i = 0; i < stride * size.height; i++) {
+    data[i] = uint8_t(i * 7);
+  }
+  for (int i = 0; i < 10; i++) {
+    PremultiplyData(data.get(), stride, SurfaceFormat::B8G8R8A8, data.get(),
+                    stride, SurfaceFormat::R8G8B8A8, size);
+  }
+});
+
 TEST(Moz2D, PremultiplyYFlipData)
 {
   const uint8_t stride = 2 * 4;
@@ -11,6 +11,7 @@
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Monitor.h"
 #include "mozilla/ProfilerLabels.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/SchedulerGroup.h"
 #include "mozilla/Services.h"
 #include "mozilla/StaticPrefs_image.h"
@@ -140,9 +141,19 @@ class DecodingTask final : public Task {
       : Task(false, aTask->Priority() == TaskPriority::eLow
                         ? EventQueuePriority::Normal
                         : EventQueuePriority::RenderBlocking),
-        mTask(aTask) {}
+        mTask(aTask),
+        mQueuedTime(TimeStamp::Now()) {}
 
   bool Run() override {
+    // Record how long the decode waited for a thread, so that decodes
+    // starved by other work show up in profiles.
+    if (mTask->Priority() == TaskPriority::eLow) {
+      PROFILER_MARKER_UNTYPED("ImageDecodeQueued", GRAPHICS,
+                              MarkerTiming::IntervalUntilNowFrom(mQueuedTime));
+    } else {
+      PROFILER_MARKER_UNTYPED("ImageDecodeQueuedHigh", GRAPHICS,
+                              MarkerTiming::IntervalUntilNowFrom(mQueuedTime));
+    }
     mTask->Run();
     return true;
   }
@@ -156,6 +167,7 @@ class DecodingTask final : public Task {
 
  private:
   RefPtr<IDecodingTask> mTask;
+  TimeStamp mQueuedTime;
 };
 
 void DecodePool::AsyncRun(IDecodingTask* aTask) {
@@ -11,7 +11,9 @@
 #include "aom/aomdx.h"
 
 #include "DAV1DDecoder.h"
+#include "DecodePool.h"
 #include "gfxPlatform.h"
+#include "mozilla/PodOperations.h"
 #include "mozilla/gfx/Types.h"
 #include "YCbCrUtils.h"
 #include "libyuv.h"
@@ -59,6 +61,14 @@ static const LABELS_AVIF_YUV_COLOR_SPACE gColorSpaceLabel[] = {
     LABELS_AVIF_YUV_COLOR_SPACE::BT601, LABELS_AVIF_YUV_COLOR_SPACE::BT709,
     LABELS_AVIF_YUV_COLOR_SPACE::BT2020, LABELS_AVIF_YUV_COLOR_SPACE::identity};
 
+// AV1 still images are split into tiles which both dav1d and libaom can
+// decode in parallel. Use several threads so large images don't decode on a
+// single core, but cap it since the DecodePool may be running several decodes
+// at once and more threads rarely help a single frame.
+static uint32_t AV1DecodeThreadCount() {
+  return std::min<uint32_t>(DecodePool::NumberOfCores(), 8);
+}
+
 static MaybeIntSize GetImageSize(const Mp4parseAvifImage& image) {
   // Note this does not take cropping via CleanAperture (clap) into account
   const struct Mp4parseImageSpatialExtents* ispe = image.spatial_extents;
@@ -593,6 +603,7 @@ class Dav1dDecoder final : AVIFDecoderInterface {
     dav1d_default_settings(&settings);
     settings.all_layers = 0;
     settings.max_frame_delay = 1;
+    settings.n_threads = static_cast<int>(AV1DecodeThreadCount());
     // TODO: tune settings a la DAV1DDecoder for AV1 (Bug 1681816)
 
     return dav1d_open(&mContext, &settings);
@@ -765,9 +776,14 @@ class AOMDecoder final : AVIFDecoderInterface {
     MOZ_ASSERT(mContext.isNothing());
 
     aom_codec_iface_t* iface = aom_codec_av1_dx();
+    aom_codec_dec_cfg_t config;
+    PodZero(&config);
+    config.threads = AV1DecodeThreadCount();
+    config.allow_lowbitdepth = true;
+
     mContext.emplace();
-    aom_codec_err_t r = aom_codec_dec_init(
-        mContext.ptr(), iface, /* cfg = */ nullptr, /* flags = */ 0);
+    aom_codec_err_t r = aom_codec_dec_init(mContext.ptr(), iface, &config,
+                                           /* flags = */ 0);
 
     MOZ_LOG(sAVIFLog, r == AOM_CODEC_OK ? LogLevel::Verbose : LogLevel::Error,
             ("[this=%p] aom_codec_dec_init -> %d, name = %s", this, r,
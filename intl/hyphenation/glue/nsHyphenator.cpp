@@ -375,7 +375,7 @@ nsresult nsHyphenator::Hyphenate(const nsAString& aString,
     }
 
     if (inWord) {
-      HyphenateWord(aString, wordStart, wordLimit, aHyphens);
+      HyphenateWordCached(aString, wordStart, wordLimit, aHyphens);
       inWord = false;
     }
   }
@@ -383,6 +383,25 @@ nsresult nsHyphenator::Hyphenate(const nsAString& aString,
   return NS_OK;
 }
 
+void nsHyphenator::HyphenateWordCached(const nsAString& aString,
+                                       uint32_t aStart, uint32_t aLimit,
+                                       nsTArray<bool>& aHyphens) {
+  const nsDependentSubstring word(aString, aStart, aLimit - aStart);
+  auto entry = mWordCache.Lookup(word);
+  if (entry) {
+    memcpy(aHyphens.Elements() + aStart, entry.Data().mHyphens.Elements(),
+           word.Length() * sizeof(bool));
+    return;
+  }
+
+  HyphenateWord(aString, aStart, aLimit, aHyphens);
+
+  CachedWord cached;
+  cached.mWord = word;
+  cached.mHyphens.AppendElements(aHyphens.Elements() + aStart, word.Length());
+  entry.Set(std::move(cached));
+}
+
 void nsHyphenator::HyphenateWord(const nsAString& aString, uint32_t aStart,
                                  uint32_t aLimit, nsTArray<bool>& aHyphens) {
   // Convert word from aStart and aLimit in aString to utf-8 for mapped_hyph,
@@ -7,6 +7,8 @@
 #define nsHyphenator_h__
 
 #include "base/shared_memory.h"
+#include "mozilla/HashFunctions.h"
+#include "mozilla/MruCache.h"
 #include "mozilla/UniquePtr.h"
 #include "mozilla/Variant.h"
 #include "nsCOMPtr.h"
@@ -49,6 +51,28 @@ class nsHyphenator {
   void HyphenateWord(const nsAString& aString, uint32_t aStart, uint32_t aLimit,
                      nsTArray<bool>& aHyphens);
 
+  // Looks the word up in mWordCache first, and only calls HyphenateWord()
+  // (and caches its result) on a miss.
+  void HyphenateWordCached(const nsAString& aString, uint32_t aStart,
+                           uint32_t aLimit, nsTArray<bool>& aHyphens);
+
+  struct CachedWord {
+    nsString mWord;
+    nsTArray<bool> mHyphens;  // one entry per UTF-16 code unit of mWord
+  };
+
+  // Reflowing text with hyphens:auto hyphenates the same words over and over,
+  // so keep the results for recently seen words.
+  struct WordCache
+      : public mozilla::MruCache<nsAString, CachedWord, WordCache, 251> {
+    static mozilla::HashNumber Hash(const nsAString& aKey) {
+      return mozilla::HashString(aKey.BeginReading(), aKey.Length());
+    }
+    static bool Match(const nsAString& aKey, const CachedWord& aVal) {
+      return aVal.mWord.Equals(aKey);
+    }
+  };
+
   mozilla::Variant<const void*,  // raw pointer to uncompressed omnijar data
                    mozilla::UniquePtr<base::SharedMemory>,  // shmem block
                    mozilla::UniquePtr<const HyphDic>  // loaded by mapped_hyph
@@ -56,6 +80,7 @@ class nsHyphenator {
       mDict;
   uint32_t mDictSize;  // size of mDict data (not used if type is HyphDic)
   bool mHyphenateCapitalized;
+  WordCache mWordCache;
 };
 
 #endif  // nsHyphenator_h__
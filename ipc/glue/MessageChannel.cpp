@@ -24,6 +24,7 @@
 #include "mozilla/ScopeExit.h"
 #include "mozilla/Sprintf.h"
 #include "mozilla/StaticMutex.h"
+#include "mozilla/StaticPrefs_dom.h"
 #include "mozilla/Telemetry.h"
 #include "mozilla/TimeStamp.h"
 #include "mozilla/UniquePtrExtensions.h"
@@ -416,6 +417,98 @@ ChannelCountReporter::CountTable* ChannelCountReporter::sChannelCounts;
 
 NS_IMPL_ISUPPORTS(ChannelCountReporter, nsIMemoryReporter)
 
+// Per-message-type statistics, only collected while
+// dom.ipc.message_stats.enabled is set. Message types encode the protocol in
+// their upper bits, so the message name identifies both.
+class MessageStatsReporter final : public nsIMemoryReporter {
+  ~MessageStatsReporter() = default;
+
+  struct MessageStats {
+    uint64_t mSentCount = 0;
+    uint64_t mSentBytes = 0;
+    uint64_t mReceivedCount = 0;
+    uint64_t mReceivedBytes = 0;
+    uint64_t mDispatchTimeUs = 0;
+  };
+
+  using StatsTable = nsTHashMap<nsUint32HashKey, MessageStats>;
+
+  static StaticMutex sStatsMutex;
+  static StatsTable* sStats MOZ_GUARDED_BY(sStatsMutex);
+
+  static MessageStats& StatsFor(uint32_t aType) MOZ_REQUIRES(sStatsMutex) {
+    if (!sStats) {
+      sStats = new StatsTable;
+    }
+    return sStats->LookupOrInsert(aType);
+  }
+
+ public:
+  NS_DECL_THREADSAFE_ISUPPORTS
+
+  static bool Enabled() { return StaticPrefs::dom_ipc_message_stats_enabled(); }
+
+  static void RecordSent(const Message& aMsg) {
+    StaticMutexAutoLock lock(sStatsMutex);
+    MessageStats& stats = StatsFor(aMsg.type());
+    stats.mSentCount++;
+    stats.mSentBytes += aMsg.size();
+  }
+
+  static void RecordDispatched(const Message& aMsg,
+                               const TimeDuration& aDispatchTime) {
+    StaticMutexAutoLock lock(sStatsMutex);
+    MessageStats& stats = StatsFor(aMsg.type());
+    stats.mReceivedCount++;
+    stats.mReceivedBytes += aMsg.size();
+    stats.mDispatchTimeUs += uint64_t(aDispatchTime.ToMicroseconds());
+  }
+
+  NS_IMETHOD
+  CollectReports(nsIHandleReportCallback* aHandleReport, nsISupports* aData,
+                 bool aAnonymize) override {
+    nsTArray<std::pair<uint32_t, MessageStats>> stats;
+    {
+      StaticMutexAutoLock lock(sStatsMutex);
+      if (!sStats) {
+        return NS_OK;
+      }
+      stats.SetCapacity(sStats->Count());
+      for (const auto& entry : *sStats) {
+        stats.AppendElement(std::pair{entry.GetKey(), entry.GetData()});
+      }
+    }
+
+    for (const auto& [type, entry] : stats) {
+      const char* name = IPC::StringFromIPCMessageType(type);
+      auto report = [&](const char* aWhat, int32_t aUnits, uint64_t aAmount,
+                        const char* aDesc) {
+        aHandleReport->Callback(
+            ""_ns, nsPrintfCString("ipc-messages/%s/%s", name, aWhat),
+            KIND_OTHER, aUnits, int64_t(aAmount),
+            nsPrintfCString(aDesc, name), aData);
+      };
+      report("sent-count", UNITS_COUNT_CUMULATIVE, entry.mSentCount,
+             "Number of %s IPC messages sent.");
+      report("sent-bytes", UNITS_BYTES, entry.mSentBytes,
+             "Total size of the %s IPC messages sent.");
+      report("received-count", UNITS_COUNT_CUMULATIVE, entry.mReceivedCount,
+             "Number of %s IPC messages received and dispatched.");
+      report("received-bytes", UNITS_BYTES, entry.mReceivedBytes,
+             "Total size of the %s IPC messages received.");
+      report("dispatch-time-us", UNITS_COUNT_CUMULATIVE, entry.mDispatchTimeUs,
+             "Total time in microseconds spent dispatching received %s IPC "
+             "messages to their actor.");
+    }
+    return NS_OK;
+  }
+};
+
+StaticMutex MessageStatsReporter::sStatsMutex;
+MessageStatsReporter::StatsTable* MessageStatsReporter::sStats;
+
+NS_IMPL_ISUPPORTS(MessageStatsReporter, nsIMemoryReporter)
+
 // In child processes, the first MessageChannel is created before
 // XPCOM is initialized enough to construct the memory reporter
 // manager.  This retries every time a MessageChannel is constructed,
@@ -444,6 +537,7 @@ MessageChannel::MessageChannel(const char* aName, IToplevelProtocol* aListener)
 
   TryRegisterStrongMemoryReporter<PendingResponseReporter>();
   TryRegisterStrongMemoryReporter<ChannelCountReporter>();
+  TryRegisterStrongMemoryReporter<MessageStatsReporter>();
 }
 
 MessageChannel::~MessageChannel() {
@@ -782,6 +876,9 @@ bool MessageChannel::Send(UniquePtr<Message> aMsg) {
 void MessageChannel::SendMessageToLink(UniquePtr<Message> aMsg) {
   AssertWorkerThread();
   mMonitor->AssertCurrentThreadOwns();
+  if (MessageStatsReporter::Enabled()) {
+    MessageStatsReporter::RecordSent(*aMsg);
+  }
   mLink->SendMessage(std::move(aMsg));
 }
 
@@ -1675,12 +1772,22 @@ void MessageChannel::DispatchMessage(ActorLifecycleProxy* aProxy,
 
       mListener->ArtificialSleep();
 
+      TimeStamp dispatchStart;
+      if (MessageStatsReporter::Enabled()) {
+        dispatchStart = TimeStamp::Now();
+      }
+
       if (aMsg->is_sync()) {
         DispatchSyncMessage(aProxy, *aMsg, reply);
       } else {
         DispatchAsyncMessage(aProxy, *aMsg);
       }
 
+      if (!dispatchStart.IsNull()) {
+        MessageStatsReporter::RecordDispatched(
+            *aMsg, TimeStamp::Now() - dispatchStart);
+      }
+
       mListener->ArtificialSleep();
     }
 
@@ -16,6 +16,8 @@ namespace ipc {
 
 static Atomic<size_t> gShmemAllocated;
 static Atomic<size_t> gShmemMapped;
+static Atomic<size_t, Relaxed> gShmemCreatedCount;
+static Atomic<size_t, Relaxed> gShmemMappedCount;
 
 class ShmemReporter final : public nsIMemoryReporter {
   ~ShmemReporter() = default;
@@ -36,6 +38,19 @@ class ShmemReporter final : public nsIMemoryReporter {
         "Memory shared with other processes that is mapped into the address "
         "space.");
 
+    MOZ_COLLECT_REPORT(
+        "shmem-created-count", KIND_OTHER, UNITS_COUNT_CUMULATIVE,
+        gShmemCreatedCount,
+        "Number of shared memory segments created by this process since "
+        "startup. A high rate means segments are being churned instead of "
+        "reused.");
+
+    MOZ_COLLECT_REPORT(
+        "shmem-mapped-count", KIND_OTHER, UNITS_COUNT_CUMULATIVE,
+        gShmemMappedCount,
+        "Number of times a shared memory segment was mapped into this "
+        "process since startup, including segments created elsewhere.");
+
     return NS_OK;
   }
 };
@@ -59,11 +74,13 @@ size_t SharedMemory::PageAlignedSize(size_t aSize) {
 void SharedMemory::Created(size_t aNBytes) {
   mAllocSize = aNBytes;
   gShmemAllocated += mAllocSize;
+  gShmemCreatedCount++;
 }
 
 void SharedMemory::Mapped(size_t aNBytes) {
   mMappedSize = aNBytes;
   gShmemMapped += mMappedSize;
+  gShmemMappedCount++;
 }
 
 void SharedMemory::Unmapped() {
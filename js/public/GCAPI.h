@@ -1002,6 +1002,44 @@ extern JS_PUBLIC_API bool IsGenerationalGCEnabled(JSRuntime* rt);
  */
 extern JS_PUBLIC_API void SetSiteBasedPretenuringEnabled(bool enable);
 
+/**
+ * Nursery allocation statistics of one script, as returned by
+ * GetTopAllocatingScripts. Counts are summed over all the allocation sites in
+ * the script; the script is identified by its filename and starting position.
+ */
+struct AllocScriptProfileEntry {
+  JS::UniqueChars filename;
+  uint32_t line = 0;
+  uint32_t column = 0;
+  uint64_t allocCount = 0;
+  uint64_t tenuredCount = 0;
+
+  double survivalRate() const {
+    return allocCount ? double(tenuredCount) / double(allocCount) : 0.0;
+  }
+};
+
+/**
+ * Start accumulating, per script, the nursery allocation and survival counts
+ * gathered by the pretenuring system, without needing the Gecko profiler. To
+ * keep the overhead low enough for production use, only one minor GC out of
+ * |sampleInterval| is recorded. Enabling again discards previous data.
+ * Returns false on OOM.
+ */
+extern JS_PUBLIC_API bool EnableAllocScriptProfiling(JSContext* cx,
+                                                     uint32_t sampleInterval);
+
+extern JS_PUBLIC_API void DisableAllocScriptProfiling(JSContext* cx);
+
+/**
+ * Append to |scriptsOut| the |maxCount| scripts with the most recorded nursery
+ * allocations, most allocating first. Returns false on OOM. Returns true with
+ * no scripts if profiling is not enabled.
+ */
+extern JS_PUBLIC_API bool GetTopAllocatingScripts(
+    JSContext* cx, size_t maxCount,
+    mozilla::Vector<AllocScriptProfileEntry>& scriptsOut);
+
 /**
  * Pass a subclass of this "abstract" class to callees to require that they
  * never GC. Subclasses can use assertions or the hazard analysis to ensure no
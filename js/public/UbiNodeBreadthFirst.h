@@ -220,6 +220,11 @@ struct BreadthFirst {
   // A queue template. Appending and popping the front are constant time.
   // Wasted space is never more than some recent actual population plus the
   // current population.
+  //
+  // Once the head is exhausted, its storage is recycled as the new tail. On
+  // large heaps, each breadth-first level can hold millions of nodes, and
+  // reusing the storage avoids growing every level from scratch, which would
+  // copy the vector and briefly hold both the old and new buffers.
   template <typename T>
   class Queue {
     js::Vector<T, 0, js::SystemAllocPolicy> head, tail;
@@ -236,7 +241,7 @@ struct BreadthFirst {
       MOZ_ASSERT(!empty());
       frontIndex++;
       if (frontIndex >= head.length()) {
-        head.clearAndFree();
+        head.clear();
         head.swap(tail);
         frontIndex = 0;
       }
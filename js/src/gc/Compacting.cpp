@@ -686,6 +686,21 @@ void GCRuntime::updateCellPointers(Zone* zone, AllocKinds kinds) {
   for (; !fgArenas.done(); fgArenas.next()) {
     UpdateArenaListSegmentPointers(this, fgArenas.get());
   }
+
+  // Rather than waiting for the background tasks to finish, help them by
+  // taking segments from the same work list.
+  for (;;) {
+    ArenaListSegment segment;
+    {
+      AutoLockHelperThreadState lock;
+      if (bgArenas.done()) {
+        break;
+      }
+      segment = bgArenas.get();
+      bgArenas.next();
+    }
+    UpdateArenaListSegmentPointers(this, segment);
+  }
 }
 
 // After cells have been relocated any pointers to a cell's old locations must
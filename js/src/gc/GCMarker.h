@@ -23,6 +23,10 @@ class WeakMapBase;
 
 static const size_t MARK_STACK_BASE_CAPACITY = 4096;
 
+// Mark stacks up to this many entries are kept between GCs rather than being
+// shrunk back to MARK_STACK_BASE_CAPACITY.
+static const size_t MARK_STACK_RETAINED_CAPACITY = 64 * 1024;
+
 enum class SlotsOrElementsKind { Elements, FixedSlots, DynamicSlots };
 
 namespace gc {
@@ -1599,10 +1599,19 @@ void MarkStack::setMaxCapacity(size_t maxCapacity) {
 #endif
 
 void MarkStack::clear() {
+  topIndex_ = 0;
+
+  // Large heaps regrow the stack through a series of doublings, each of which
+  // reallocates and re-poisons it, at the start of every GC. Keep a moderately
+  // sized stack around to avoid that.
+  if (capacity() <= MARK_STACK_RETAINED_CAPACITY) {
+    poisonUnused();
+    return;
+  }
+
   // Fall back to the smaller initial capacity so we don't hold on to excess
   // memory between GCs.
   stack().clearAndFree();
-  topIndex_ = 0;
   std::ignore = resetStackCapacity();
 }
 
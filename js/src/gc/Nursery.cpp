@@ -707,6 +707,27 @@ void* js::Nursery::reallocateBuffer(Zone* zone, Cell* cell, void* oldBuffer,
     return oldBuffer;
   }
 
+  // If this was the most recent nursery allocation and there is room left in
+  // the current chunk then grow it in place rather than allocating and
+  // copying. This is common when an object's slots are grown repeatedly as
+  // properties are added to it straight after it is created.
+  if (uintptr_t(oldBuffer) + oldBytes == position() &&
+      newBytes <= MaxNurseryBufferSize && newBytes % CellAlignBytes == 0 &&
+      position() + (newBytes - oldBytes) <= currentEnd()) {
+#ifdef JS_GC_ZEAL
+    bool canGrowInPlace = !gc->hasZealMode(ZealMode::CheckNursery);
+#else
+    bool canGrowInPlace = true;
+#endif
+    if (canGrowInPlace) {
+      void* extra = (void*)position();
+      position_ = position() + (newBytes - oldBytes);
+      DebugOnlyPoison(extra, JS_ALLOCATED_NURSERY_PATTERN, newBytes - oldBytes,
+                      MemCheckKind::MakeUndefined);
+      return oldBuffer;
+    }
+  }
+
   void* newBuffer = allocateBuffer(zone, newBytes);
   if (newBuffer) {
     PodCopy((uint8_t*)newBuffer, (uint8_t*)oldBuffer, oldBytes);
@@ -1092,9 +1113,17 @@ void js::Nursery::collect(JS::GCOptions options, JS::GCReason reason) {
   stats().beginNurseryCollection(reason);
   gcprobes::MinorGCStart();
 
-  stringDeDupSet.emplace();
-  auto guardStringDedupSet =
-      mozilla::MakeScopeExit([&] { stringDeDupSet.reset(); });
+  // Presize the deduplication set from the previous collection to avoid
+  // rehashing it repeatedly while tenuring. Cap this so that one unusually
+  // large collection doesn't make all later ones allocate a big table.
+  static constexpr uint32_t MaxInitialStringDeDupSetLength = 64 * 1024;
+  stringDeDupSet.emplace(
+      std::min(previousStringDeDupSetCount, MaxInitialStringDeDupSetLength));
+  auto guardStringDedupSet = mozilla::MakeScopeExit([&] {
+    previousStringDeDupSetCount =
+        stringDeDupSet.isSome() ? stringDeDupSet->count() : 0;
+    stringDeDupSet.reset();
+  });
 
   maybeClearProfileDurations();
   startProfile(ProfileKey::Total);
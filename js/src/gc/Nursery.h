@@ -371,6 +371,15 @@ class Nursery {
 
   bool canCreateAllocSite() { return pretenuringNursery.canCreateAllocSite(); }
   void noteAllocSiteCreated() { pretenuringNursery.noteAllocSiteCreated(); }
+  [[nodiscard]] bool enableAllocScriptProfiling(uint32_t sampleInterval) {
+    return pretenuringNursery.enableAllocScriptProfiling(sampleInterval);
+  }
+  void disableAllocScriptProfiling() {
+    pretenuringNursery.disableAllocScriptProfiling();
+  }
+  const gc::AllocScriptProfile* maybeAllocScriptProfile() const {
+    return pretenuringNursery.maybeAllocScriptProfile();
+  }
   bool reportPretenuring() const { return reportPretenuring_; }
   void maybeStopPretenuring(gc::GCRuntime* gc) {
     pretenuringNursery.maybeStopPretenuring(gc);
@@ -573,6 +582,10 @@ class Nursery {
   // collection when out of memory to insert new entries.
   mozilla::Maybe<StringDeDupSet> stringDeDupSet;
 
+  // The number of entries in stringDeDupSet at the end of the previous
+  // collection, used to presize the set for the next one.
+  uint32_t previousStringDeDupSetCount = 0;
+
   // Lists of map and set objects allocated in the nursery or with iterators
   // allocated there. Such objects need to be swept after minor GC.
   Vector<MapObject*, 0, SystemAllocPolicy> mapsWithNurseryMemory_;
@@ -7,11 +7,15 @@
 
 #include "gc/Pretenuring.h"
 
+#include "mozilla/HashFunctions.h"
 #include "mozilla/Sprintf.h"
 
+#include <string.h>
+
 #include "gc/GCInternals.h"
 #include "gc/PublicIterators.h"
 #include "jit/Invalidation.h"
+#include "vm/JSContext.h"
 
 #include "gc/PrivateIterators-inl.h"
 #include "vm/JSScript-inl.h"
@@ -103,6 +107,9 @@ size_t PretenuringNursery::doPretenuring(GCRuntime* gc, JS::GCReason reason,
     AllocSite::printInfoHeader(reason, promotionRate);
   }
 
+  bool recordSites =
+      allocScriptProfile && allocScriptProfile->shouldSample();
+
   AllocSite* site = allocatedSites;
   allocatedSites = AllocSite::EndSentinel;
   while (site != AllocSite::EndSentinel) {
@@ -150,6 +157,10 @@ size_t PretenuringNursery::doPretenuring(GCRuntime* gc, JS::GCReason reason,
       site->printInfo(hasPromotionRate, promotionRate, wasInvalidated);
     }
 
+    if (recordSites && site->hasScript()) {
+      allocScriptProfile->record(site);
+    }
+
     site->resetNurseryAllocations();
 
     site = next;
@@ -178,6 +189,100 @@ size_t PretenuringNursery::doPretenuring(GCRuntime* gc, JS::GCReason reason,
   return sitesPretenured;
 }
 
+bool PretenuringNursery::enableAllocScriptProfiling(uint32_t sampleInterval) {
+  allocScriptProfile = MakeUnique<AllocScriptProfile>(sampleInterval);
+  return bool(allocScriptProfile);
+}
+
+/* static */
+HashNumber AllocScriptProfile::Hasher::hash(const Lookup& l) {
+  return mozilla::AddToHash(mozilla::HashString(l.filename), l.line, l.column);
+}
+
+/* static */
+bool AllocScriptProfile::Hasher::match(const Key& k, const Lookup& l) {
+  return k.line == l.line && k.column == l.column &&
+         strcmp(k.filename.get(), l.filename) == 0;
+}
+
+void AllocScriptProfile::record(const AllocSite* site) {
+  MOZ_ASSERT(site->hasScript());
+  if (!site->nurseryAllocCount) {
+    return;
+  }
+
+  JSScript* script = site->script();
+  const char* filename = script->filename() ? script->filename() : "";
+  Lookup lookup{filename, script->lineno(), script->column()};
+
+  // Failing to record a script is not an error, the profile is best effort.
+  auto ptr = scripts.lookupForAdd(lookup);
+  if (!ptr) {
+    if (scripts.count() >= MaxEntries) {
+      return;
+    }
+    UniqueChars copy = DuplicateString(filename);
+    if (!copy ||
+        !scripts.add(ptr, Key{std::move(copy), lookup.line, lookup.column},
+                   Counts())) {
+      return;
+    }
+  }
+
+  ptr->value().allocCount += site->nurseryAllocCount;
+  ptr->value().tenuredCount += site->nurseryTenuredCount;
+}
+
+bool AllocScriptProfile::getTopScripts(
+    size_t maxCount,
+    mozilla::Vector<JS::AllocScriptProfileEntry>& scriptsOut) const {
+  using Entry = decltype(scripts)::Entry;
+  mozilla::Vector<const Entry*> entries;
+  if (!entries.reserve(scripts.count())) {
+    return false;
+  }
+  for (auto iter = scripts.iter(); !iter.done(); iter.next()) {
+    entries.infallibleAppend(&iter.get());
+  }
+
+  size_t count = std::min(maxCount, entries.length());
+  std::partial_sort(entries.begin(), entries.begin() + count, entries.end(),
+                    [](const Entry* a, const Entry* b) {
+                      return a->value().allocCount > b->value().allocCount;
+                    });
+
+  for (size_t i = 0; i < count; i++) {
+    const Entry& entry = *entries[i];
+    UniqueChars filename = DuplicateString(entry.key().filename.get());
+    if (!filename ||
+        !scriptsOut.append(JS::AllocScriptProfileEntry{
+            std::move(filename), entry.key().line, entry.key().column,
+            entry.value().allocCount, entry.value().tenuredCount})) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+JS_PUBLIC_API bool JS::EnableAllocScriptProfiling(JSContext* cx,
+                                                  uint32_t sampleInterval) {
+  return cx->runtime()->gc.nursery().enableAllocScriptProfiling(
+      sampleInterval);
+}
+
+JS_PUBLIC_API void JS::DisableAllocScriptProfiling(JSContext* cx) {
+  cx->runtime()->gc.nursery().disableAllocScriptProfiling();
+}
+
+JS_PUBLIC_API bool JS::GetTopAllocatingScripts(
+    JSContext* cx, size_t maxCount,
+    mozilla::Vector<AllocScriptProfileEntry>& scriptsOut) {
+  const AllocScriptProfile* profile =
+      cx->runtime()->gc.nursery().maybeAllocScriptProfile();
+  return !profile || profile->getTopScripts(maxCount, scriptsOut);
+}
+
 void PretenuringNursery::reportAndResetCatchAllSite(AllocSite* site,
                                                     bool reportInfo,
                                                     size_t reportThreshold) {
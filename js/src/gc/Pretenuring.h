@@ -22,7 +22,12 @@
 #include <algorithm>
 
 #include "gc/AllocKind.h"
+#include "js/AllocPolicy.h"
+#include "js/GCAPI.h"
+#include "js/HashTable.h"
 #include "js/TypeDecls.h"
+#include "js/UniquePtr.h"
+#include "js/Utility.h"
 
 class JS_PUBLIC_API JSTracer;
 
@@ -33,6 +38,7 @@ enum class GCReason;
 namespace js {
 namespace gc {
 
+class AllocScriptProfile;
 class GCRuntime;
 class PretenuringNursery;
 
@@ -79,6 +85,7 @@ class AllocSite {
 
   static AllocSite* const EndSentinel;
 
+  friend class AllocScriptProfile;
   friend class PretenuringZone;
   friend class PretenuringNursery;
 
@@ -225,12 +232,67 @@ class PretenuringZone {
   bool shouldResetPretenuredAllocSites();
 };
 
+// Nursery allocation and survival counts of scripts, accumulated across minor
+// collections while allocation profiling is enabled (see
+// JS::EnableAllocScriptProfiling). AllocSites don't record their bytecode
+// position, so the counts of all the sites in a script are summed under the
+// script's location. Entries outlive the scripts and their AllocSites.
+class AllocScriptProfile {
+ public:
+  explicit AllocScriptProfile(uint32_t sampleInterval)
+      : sampleInterval(std::max(sampleInterval, 1u)) {}
+
+  // Whether the sites of the current minor collection should be recorded.
+  bool shouldSample() { return (minorGCCount++ % sampleInterval) == 0; }
+
+  void record(const AllocSite* site);
+
+  [[nodiscard]] bool getTopScripts(
+      size_t maxCount,
+      mozilla::Vector<JS::AllocScriptProfileEntry>& scriptsOut) const;
+
+ private:
+  struct Lookup {
+    const char* filename;
+    uint32_t line;
+    uint32_t column;
+  };
+
+  struct Key {
+    JS::UniqueChars filename;
+    uint32_t line;
+    uint32_t column;
+  };
+
+  struct Hasher {
+    using Lookup = AllocScriptProfile::Lookup;
+    static HashNumber hash(const Lookup& l);
+    static bool match(const Key& k, const Lookup& l);
+  };
+
+  struct Counts {
+    uint64_t allocCount = 0;
+    uint64_t tenuredCount = 0;
+  };
+
+  // Bound the memory used by the profile, scripts seen after this limit is
+  // reached are dropped.
+  static constexpr size_t MaxEntries = 4096;
+
+  HashMap<Key, Counts, Hasher, SystemAllocPolicy> scripts;
+  const uint32_t sampleInterval;
+  uint64_t minorGCCount = 0;
+};
+
 // Pretenuring information stored as part of the the GC nursery.
 class PretenuringNursery {
   gc::AllocSite* allocatedSites;
 
   size_t allocSitesCreated = 0;
 
+  // Only present while allocation profiling is enabled.
+  UniquePtr<AllocScriptProfile> allocScriptProfile;
+
  public:
   PretenuringNursery() : allocatedSites(AllocSite::EndSentinel) {}
 
@@ -255,6 +317,12 @@ class PretenuringNursery {
 
   void* addressOfAllocatedSites() { return &allocatedSites; }
 
+  [[nodiscard]] bool enableAllocScriptProfiling(uint32_t sampleInterval);
+  void disableAllocScriptProfiling() { allocScriptProfile.reset(); }
+  const AllocScriptProfile* maybeAllocScriptProfile() const {
+    return allocScriptProfile.get();
+  }
+
  private:
   void reportAndResetCatchAllSite(AllocSite* site, bool reportInfo,
                                   size_t reportThreshold);
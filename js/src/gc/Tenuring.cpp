@@ -25,6 +25,7 @@
 #include "vm/Runtime.h"
 #include "vm/TypedArrayObject.h"
 
+#include "gc/ArenaList-inl.h"
 #include "gc/Heap-inl.h"
 #include "gc/Marking-inl.h"
 #include "gc/ObjectKind-inl.h"
@@ -480,7 +481,13 @@ inline void js::TenuringTracer::insertIntoObjectFixupList(
 
 template <typename T>
 inline T* js::TenuringTracer::allocTenured(Zone* zone, AllocKind kind) {
-  return static_cast<T*>(static_cast<Cell*>(AllocateCellInGC(zone, kind)));
+  // Every promoted cell comes through here, so pop the free list inline and
+  // only make the out-of-line call when the list needs refilling.
+  TenuredCell* cell = zone->arenas.allocateFromFreeList(kind);
+  if (MOZ_UNLIKELY(!cell)) {
+    cell = AllocateCellInGC(zone, kind);
+  }
+  return static_cast<T*>(static_cast<Cell*>(cell));
 }
 
 JSString* js::TenuringTracer::allocTenuredString(JSString* src, Zone* zone,
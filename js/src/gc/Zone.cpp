@@ -620,7 +620,15 @@ bool Zone::addRttValueObject(JSContext* cx, HandleObject obj) {
 }
 
 void Zone::purgeAtomCache() {
-  atomCache().clearAndCompact();
+  // Keep the table's storage if it is not too large. The cache is typically
+  // repopulated with a similar number of atoms straight after GC, and
+  // regrowing it from empty means rehashing it several times.
+  static constexpr size_t MaxRetainedAtomCacheCapacity = 4096;
+  if (atomCache().capacity() <= MaxRetainedAtomCacheCapacity) {
+    atomCache().clear();
+  } else {
+    atomCache().clearAndCompact();
+  }
 
   // Also purge the dtoa caches so that subsequent lookups populate atom
   // cache too.
@@ -0,0 +1,80 @@
+// Plain objects that have all their properties deleted may go back to a
+// shared shape. Check that filling and draining them repeatedly, above and
+// below the slot span threshold, keeps property semantics intact, and that
+// prototypes and non-plain objects are left alone.
+
+function fillAndDrain(count, rounds) {
+    var o = {};
+    for (var round = 0; round < rounds; round++) {
+        for (var i = 0; i < count; i++) {
+            o["p" + i] = i + round;
+        }
+        assertEq(Object.keys(o).length, count);
+        assertEq(o.p0, round);
+        assertEq(o["p" + (count - 1)], count - 1 + round);
+
+        // Delete in insertion order so every deletion but the last is a
+        // non-last property and forces dictionary mode.
+        for (var i = 0; i < count; i++) {
+            assertEq(delete o["p" + i], true);
+        }
+        assertEq(Object.keys(o).length, 0);
+        assertEq(o.p0, undefined);
+
+        // Re-adding after the object became empty must start from scratch.
+        o.x = round;
+        o.y = round + 1;
+        assertEq(JSON.stringify(o),
+                 '{"x":' + round + ',"y":' + (round + 1) + '}');
+        delete o.x;
+        delete o.y;
+        assertEq(Object.keys(o).length, 0);
+    }
+}
+fillAndDrain(8, 50);
+fillAndDrain(100, 20);
+
+// Prototypes keep their dictionary shape; lookups through them must still
+// see properties added after everything was deleted.
+var proto = {};
+for (var i = 0; i < 100; i++) {
+    proto["p" + i] = i;
+}
+var child = Object.create(proto);
+function readP5(o) { return o.p5; }
+for (var i = 0; i < 100; i++) {
+    assertEq(readP5(child), 5);
+}
+for (var i = 0; i < 100; i++) {
+    delete proto["p" + i];
+}
+assertEq(readP5(child), undefined);
+proto.p5 = "again";
+for (var i = 0; i < 100; i++) {
+    assertEq(readP5(child), "again");
+}
+
+// Non-plain objects are excluded.
+var arr = [1, 2, 3];
+for (var i = 0; i < 100; i++) {
+    arr["p" + i] = i;
+}
+for (var i = 0; i < 100; i++) {
+    delete arr["p" + i];
+}
+assertEq(arr.length, 3);
+arr.q = 1;
+assertEq(arr.q, 1);
+assertEq(arr[2], 3);
+
+var fun = function () { return 42; };
+for (var i = 0; i < 100; i++) {
+    fun["p" + i] = i;
+}
+for (var i = 0; i < 100; i++) {
+    delete fun["p" + i];
+}
+assertEq(fun(), 42);
+assertEq(fun.name, "fun");
+fun.q = 2;
+assertEq(fun.q, 2);
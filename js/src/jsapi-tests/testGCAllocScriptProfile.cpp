@@ -0,0 +1,87 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+
+#include "js/GCAPI.h"
+#include "jsapi-tests/tests.h"
+
+#include "vm/JSContext-inl.h"
+
+static const char* const AllocScriptFilename = "alloc-script-profile.js";
+
+// The allocating function starts on line 2 of AllocScriptFilename.
+static const char AllocScriptSource[] =
+    "\n"
+    "function allocate(n) {\n"
+    "  var keep = [];\n"
+    "  for (var i = 0; i < n; i++) {\n"
+    "    keep.push({ i });\n"
+    "  }\n"
+    "  return keep.length;\n"
+    "}\n";
+
+static const JS::AllocScriptProfileEntry* FindScript(
+    const mozilla::Vector<JS::AllocScriptProfileEntry>& scripts) {
+  for (const JS::AllocScriptProfileEntry& entry : scripts) {
+    if (strcmp(entry.filename.get(), AllocScriptFilename) == 0) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+BEGIN_TEST(testGCAllocScriptProfile) {
+  // Allocation sites are created by the baseline ICs, so there is nothing to
+  // profile without them.
+  uint32_t blinterpEnabled;
+  CHECK(JS_GetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_INTERPRETER_ENABLE, &blinterpEnabled));
+  if (!blinterpEnabled) {
+    return true;
+  }
+
+  uint32_t oldWarmupTrigger;
+  CHECK(JS_GetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_INTERPRETER_WARMUP_TRIGGER,
+      &oldWarmupTrigger));
+  JS_SetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_INTERPRETER_WARMUP_TRIGGER, 0);
+
+  CHECK(exec(AllocScriptSource, AllocScriptFilename, 1));
+
+  // Only every second minor GC is recorded.
+  CHECK(JS::EnableAllocScriptProfiling(cx, 2));
+  for (size_t i = 0; i < 4; i++) {
+    EXEC("allocate(1000);");
+    cx->minorGC(JS::GCReason::API);
+  }
+
+  mozilla::Vector<JS::AllocScriptProfileEntry> scripts;
+  CHECK(JS::GetTopAllocatingScripts(cx, 10, scripts));
+  const JS::AllocScriptProfileEntry* entry = FindScript(scripts);
+  CHECK(entry);
+  CHECK_EQUAL(entry->line, 2u);
+  CHECK(entry->allocCount > 0);
+  CHECK(entry->tenuredCount <= entry->allocCount);
+
+  // The caller passed in maxCount and gets at most that many entries.
+  scripts.clear();
+  CHECK(JS::GetTopAllocatingScripts(cx, 1, scripts));
+  CHECK(scripts.length() == 1);
+
+  // Disabling drops the collected data.
+  JS::DisableAllocScriptProfiling(cx);
+  scripts.clear();
+  CHECK(JS::GetTopAllocatingScripts(cx, 10, scripts));
+  CHECK(scripts.empty());
+
+  JS_SetGlobalJitCompilerOption(
+      cx, JSJITCOMPILER_BASELINE_INTERPRETER_WARMUP_TRIGGER, oldWarmupTrigger);
+  return true;
+}
+END_TEST(testGCAllocScriptProfile)
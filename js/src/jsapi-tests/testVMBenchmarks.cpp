@@ -0,0 +1,173 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Fixed-iteration micro benchmarks for VM and GC hot paths, only run with
+// `jsapi-tests --bench`. Each prints PERFHERDER_DATA lines in optimized builds.
+
+#include "mozilla/Sprintf.h"
+
+#include "gc/GC.h"
+#include "js/GCVector.h"            // JS::RootedVector
+#include "js/PropertyAndElement.h"  // JS_DefinePropertyById, JS_GetPropertyById
+#include "js/StructuredClone.h"     // JS_StructuredClone
+#include "jsapi-tests/tests.h"
+#include "vm/JSAtom.h"  // js::AtomizeChars
+#include "vm/NativeObject.h"
+
+#include "vm/JSContext-inl.h"
+
+using namespace js;
+
+static constexpr size_t BenchPropertyCount = 32;
+
+static JSObject* NewBenchObject(JSContext* cx,
+                                JS::MutableHandleVector<JS::PropertyKey> ids) {
+  JS::RootedObject obj(cx, JS_NewPlainObject(cx));
+  if (!obj) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < BenchPropertyCount; i++) {
+    char name[16];
+    SprintfLiteral(name, "prop%zu", i);
+    JS::RootedString str(cx, JS_AtomizeAndPinString(cx, name));
+    if (!str) {
+      return nullptr;
+    }
+    JS::RootedId id(cx, JS::PropertyKey::fromPinnedString(str));
+    JS::RootedValue v(cx, JS::Int32Value(int32_t(i)));
+    if (!ids.append(id) || !JS_DefinePropertyById(cx, obj, id, v, 0)) {
+      return nullptr;
+    }
+  }
+  return obj;
+}
+
+BEGIN_BENCHMARK(benchNativeObjectSlots) {
+  JS::RootedVector<JS::PropertyKey> ids(cx);
+  JS::RootedObject obj(cx, NewBenchObject(cx, &ids));
+  CHECK(obj);
+
+  CHECK(benchmark("setAndGetSlots", [&]() {
+    NativeObject& nobj = obj->as<NativeObject>();
+    uint32_t span = nobj.slotSpan();
+    int32_t sum = 0;
+    for (int32_t iter = 0; iter < 100000; iter++) {
+      for (uint32_t i = 0; i < span; i++) {
+        nobj.setSlot(i, JS::Int32Value(iter));
+        sum += nobj.getSlot(i).toInt32() & 1;
+      }
+    }
+    return sum >= 0;
+  }));
+
+  return true;
+}
+END_TEST(benchNativeObjectSlots)
+
+BEGIN_BENCHMARK(benchPropMapLookup) {
+  JS::RootedVector<JS::PropertyKey> ids(cx);
+  JS::RootedObject obj(cx, NewBenchObject(cx, &ids));
+  CHECK(obj);
+
+  CHECK(benchmark("getPropertyById", [&]() {
+    JS::RootedValue v(cx);
+    for (size_t iter = 0; iter < 20000; iter++) {
+      for (size_t i = 0; i < ids.length(); i++) {
+        if (!JS_GetPropertyById(cx, obj, ids[i], &v) || !v.isInt32()) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }));
+
+  return true;
+}
+END_TEST(benchPropMapLookup)
+
+BEGIN_BENCHMARK(benchAtomizeChars) {
+  // Atomize a fixed set of strings, the first replicate mostly adds them to
+  // the atoms table while the following ones look them up.
+  CHECK(benchmark("atomizeLatin1", [&]() {
+    for (size_t iter = 0; iter < 20; iter++) {
+      for (size_t i = 0; i < 4096; i++) {
+        char name[32];
+        int length = SprintfLiteral(name, "benchmarkAtom%zu", i);
+        const auto* chars = reinterpret_cast<const JS::Latin1Char*>(name);
+        if (!AtomizeChars(cx, chars, size_t(length))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }));
+
+  return true;
+}
+END_TEST(benchAtomizeChars)
+
+BEGIN_BENCHMARK(benchStructuredClone) {
+  JS::RootedValue source(cx);
+  EVAL(
+      "({ numbers: Array.from({length: 1000}, (_, i) => i * 1.5),"
+      "   strings: Array.from({length: 200}, (_, i) => 'string' + i),"
+      "   records: Array.from({length: 200},"
+      "                       (_, i) => ({ id: i, name: 'n' + i, ok: true }))"
+      "})",
+      &source);
+
+  CHECK(benchmark("cloneObjectGraph", [&]() {
+    JS::RootedValue clone(cx);
+    for (size_t iter = 0; iter < 100; iter++) {
+      if (!JS_StructuredClone(cx, source, &clone, nullptr, nullptr)) {
+        return false;
+      }
+    }
+    return true;
+  }));
+
+  return true;
+}
+END_TEST(benchStructuredClone)
+
+BEGIN_BENCHMARK(benchGCPauses) {
+  auto allocate = [&]() {
+    for (size_t i = 0; i < 10000; i++) {
+      if (!JS_NewPlainObject(cx)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // Keep some tenured objects alive so that major GCs have work to do.
+  JS::RootedValue retained(cx);
+  EVAL("Array.from({length: 50000}, (_, i) => ({ i }))", &retained);
+
+  CHECK(benchmark("minorGC", [&]() {
+    for (size_t iter = 0; iter < 20; iter++) {
+      if (!allocate()) {
+        return false;
+      }
+      cx->minorGC(JS::GCReason::API);
+    }
+    return true;
+  }));
+
+  CHECK(benchmark("majorGC", [&]() {
+    for (size_t iter = 0; iter < 5; iter++) {
+      if (!allocate()) {
+        return false;
+      }
+      JS::NonIncrementalGC(cx, JS::GCOptions::Normal, JS::GCReason::API);
+    }
+    return true;
+  }));
+
+  return true;
+}
+END_TEST(benchGCPauses)
@@ -133,6 +133,16 @@ int main(int argc, char* argv[]) {
   int failures = 0;
   const char* filter = (argc == 2) ? argv[1] : nullptr;
 
+  // With --bench, only run the benchmarks, optionally filtered.
+  bool benchmarks = false;
+  if (filter && strcmp(filter, "--bench") == 0) {
+    benchmarks = true;
+    filter = nullptr;
+  } else if (argc == 3 && strcmp(argv[1], "--bench") == 0) {
+    benchmarks = true;
+    filter = argv[2];
+  }
+
   if (!JS_Init()) {
     printf("TEST-UNEXPECTED-FAIL | jsapi-tests | JS_Init() failed.\n");
     return 1;
@@ -154,6 +164,9 @@ int main(int argc, char* argv[]) {
     if (filter && strstr(name, filter) == nullptr) {
       continue;
     }
+    if (test->isBenchmark != benchmarks) {
+      continue;
+    }
 
     total += 1;
 
@@ -8,8 +8,11 @@
 #define jsapi_tests_tests_h
 
 #include "mozilla/Sprintf.h"
+#include "mozilla/TimeStamp.h"
 
+#include <algorithm>
 #include <errno.h>
+#include <inttypes.h>
 #include <iterator>
 #include <stdio.h>
 #include <stdlib.h>
@@ -87,7 +90,12 @@ class JSAPITest {
   // another reuseGlobal test.
   bool reuseGlobal;
 
-  JSAPITest() : cx(nullptr), knownFail(false), reuseGlobal(false) {
+  // Benchmarks are only run when jsapi-tests is invoked with --bench, see
+  // BEGIN_BENCHMARK and benchmark() below.
+  bool isBenchmark;
+
+  JSAPITest()
+      : cx(nullptr), knownFail(false), reuseGlobal(false), isBenchmark(false) {
     next = list;
     list = this;
   }
@@ -320,6 +328,45 @@ class JSAPITest {
 
   JSAPITestString messages() const { return msgs; }
 
+  static constexpr size_t BenchmarkReplicates = 5;
+
+  // Time `BenchmarkReplicates` runs of `body`, which returns false on failure,
+  // and print the median duration in microseconds as PERFHERDER_DATA, using
+  // the same format as MOZ_GTEST_BENCH. The body is still run, but nothing is
+  // reported, in debug and ASan builds.
+  template <typename F>
+  bool benchmark(const char* subtest, F&& body) {
+    int64_t durations[BenchmarkReplicates];
+    for (size_t i = 0; i < BenchmarkReplicates; i++) {
+      mozilla::TimeStamp start = mozilla::TimeStamp::Now();
+      if (!body()) {
+        return false;
+      }
+      durations[i] =
+          int64_t((mozilla::TimeStamp::Now() - start).ToMicroseconds());
+    }
+
+#if !defined(DEBUG) && !defined(MOZ_ASAN)
+    char replicates[BenchmarkReplicates * 24];
+    size_t length = 0;
+    for (size_t i = 0; i < BenchmarkReplicates; i++) {
+      length += SprintfBuf(replicates + length, sizeof(replicates) - length,
+                           "%s%" PRId64, i ? "," : "", durations[i]);
+    }
+
+    std::sort(std::begin(durations), std::end(durations));
+    printf(
+        "PERFHERDER_DATA: {\"framework\": {\"name\": "
+        "\"platform_microbench\"}, \"suites\": [{\"name\": \"jsapi-tests\", "
+        "\"subtests\": [{\"name\": \"%s.%s\", \"value\": %" PRId64
+        ", \"replicates\": [%s], \"lowerIsBetter\": true, "
+        "\"shouldAlert\": %s}]}]}\n",
+        name(), subtest, durations[BenchmarkReplicates / 2], replicates,
+        getenv("PERFHERDER_ALERTING_ENABLED") ? "true" : "false");
+#endif
+    return true;
+  }
+
   static const JSClass* basicGlobalClass() {
     static const JSClass c = {"global", JSCLASS_GLOBAL_FLAGS,
                               &JS::DefaultGlobalClassOps};
@@ -388,6 +435,13 @@ class JSAPITest {
       testname, , cls_##testname()      \
       : JSAPITest() { reuseGlobal = true; })
 
+// Fixed-iteration micro benchmarks, skipped unless jsapi-tests runs with
+// --bench. Use benchmark() inside to time and report each measurement.
+#define BEGIN_BENCHMARK(testname)       \
+  BEGIN_TEST_WITH_ATTRIBUTES_AND_EXTRA( \
+      testname, , cls_##testname()      \
+      : JSAPITest() { isBenchmark = true; })
+
 #define END_TEST(testname) \
   }                        \
   ;                        \
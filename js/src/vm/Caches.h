@@ -183,6 +183,10 @@ class MegamorphicCache {
   // Generation counter used to invalidate all entries.
   uint16_t generation_ = 0;
 
+  // Whether any entry has been initialized for the current generation. When
+  // this is false, no entry can match and there is nothing to invalidate.
+  bool hasEntriesForGeneration_ = false;
+
   // NOTE: this logic is mirrored in MacroAssembler::emitMegamorphicCacheLookup
   Entry& getEntry(Shape* shape, PropertyKey key) {
     static_assert(mozilla::IsPowerOfTwo(NumEntries),
@@ -195,6 +199,13 @@ class MegamorphicCache {
 
  public:
   void bumpGeneration() {
+    // Prototype mutations are frequent while scripts are initializing, before
+    // any megamorphic lookup populated the cache. Avoid consuming generations,
+    // and wiping the cache on overflow, when no entry is valid anyway.
+    if (!hasEntriesForGeneration_) {
+      return;
+    }
+    hasEntriesForGeneration_ = false;
     generation_++;
     if (generation_ == 0) {
       // Generation overflowed. Invalidate the whole cache.
@@ -212,11 +223,13 @@ class MegamorphicCache {
   void initEntryForMissingProperty(Entry* entry, Shape* shape,
                                    PropertyKey key) {
     entry->init(shape, key, generation_, Entry::NumHopsForMissingProperty, 0);
+    hasEntriesForGeneration_ = true;
   }
   void initEntryForMissingOwnProperty(Entry* entry, Shape* shape,
                                       PropertyKey key) {
     entry->init(shape, key, generation_, Entry::NumHopsForMissingOwnProperty,
                 0);
+    hasEntriesForGeneration_ = true;
   }
   void initEntryForDataProperty(Entry* entry, Shape* shape, PropertyKey key,
                                 size_t numHops, uint32_t slot) {
@@ -225,6 +238,7 @@ class MegamorphicCache {
       return;
     }
     entry->init(shape, key, generation_, numHops, slot);
+    hasEntriesForGeneration_ = true;
   }
 
   static constexpr size_t offsetOfEntries() {
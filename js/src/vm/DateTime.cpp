@@ -313,6 +313,20 @@ int32_t js::DateTimeInfo::getOrComputeValue(RangeCache& range, int64_t seconds,
     return range.oldOffsetMilliseconds;
   }
 
+  for (const auto& evicted : range.evicted) {
+    if (evicted.startSeconds <= seconds && seconds <= evicted.endSeconds) {
+      return evicted.offsetMilliseconds;
+    }
+  }
+
+  if (range.oldStartSeconds != INT64_MIN) {
+    auto& evicted = range.evicted[range.nextEvicted];
+    evicted.startSeconds = range.oldStartSeconds;
+    evicted.endSeconds = range.oldEndSeconds;
+    evicted.offsetMilliseconds = range.oldOffsetMilliseconds;
+    range.nextEvicted = (range.nextEvicted + 1) % RangeCache::NumEvictedRanges;
+  }
+
   range.oldOffsetMilliseconds = range.offsetMilliseconds;
   range.oldStartSeconds = range.startSeconds;
   range.oldEndSeconds = range.endSeconds;
@@ -374,6 +388,11 @@ void js::DateTimeInfo::RangeCache::reset() {
   startSeconds = endSeconds = INT64_MIN;
   oldOffsetMilliseconds = 0;
   oldStartSeconds = oldEndSeconds = INT64_MIN;
+  for (auto& range : evicted) {
+    range.offsetMilliseconds = 0;
+    range.startSeconds = range.endSeconds = INT64_MIN;
+  }
+  nextEvicted = 0;
 
   sanityCheck();
 }
@@ -389,6 +408,10 @@ void js::DateTimeInfo::RangeCache::sanityCheck() {
 
   assertRange(startSeconds, endSeconds);
   assertRange(oldStartSeconds, oldEndSeconds);
+  for (const auto& range : evicted) {
+    assertRange(range.startSeconds, range.endSeconds);
+  }
+  MOZ_ASSERT(nextEvicted < NumEvictedRanges);
 }
 
 #if JS_HAS_INTL_API
@@ -222,6 +222,18 @@ class DateTimeInfo {
     int32_t offsetMilliseconds;
     int32_t oldOffsetMilliseconds;
 
+    // Ranges which were evicted from the last cached range, such that
+    // alternating between more than two distant times, e.g. when formatting
+    // a series of timestamps spanning several years, doesn't recompute the
+    // offset on every call. Replaced in round-robin order.
+    struct EvictedRange {
+      int64_t startSeconds, endSeconds;
+      int32_t offsetMilliseconds;
+    };
+    static constexpr size_t NumEvictedRanges = 8;
+    EvictedRange evicted[NumEvictedRanges];
+    size_t nextEvicted;
+
     void reset();
 
     void sanityCheck();
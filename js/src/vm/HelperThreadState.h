@@ -685,16 +685,25 @@ struct DelazifyTask : public mozilla::LinkedListElement<DelazifyTask>,
       const JS::ReadOnlyCompileOptions& options,
       UniquePtr<frontend::ExtensibleCompilationStencil>&& initial);
 
+  // Number of functions delazified by a task before checking whether it should
+  // yield its thread to other pending tasks.
+  static constexpr size_t FunctionsPerSlice = 64;
+  size_t functionsInSlice = 0;
+
   // This function is called by delazify task thread to know whether the task
   // should be interrupted.
   //
   // A delazify task holds on a thread until all functions iterated over by the
   // strategy. However, as a delazify task iterates over multiple functions, it
-  // can easily be interrupted at function boundaries.
+  // can easily be interrupted at function boundaries. After each slice of
+  // FunctionsPerSlice functions, the task yields if parse tasks or the
+  // delazification of other sources are waiting, such that a single large
+  // source does not starve them. The task is then re-queued at the end of the
+  // delazification worklist.
   //
   // TODO: (Bug 1773683) Plug this with the mozilla::Task::RequestInterrupt
   // function which is wrapping HelperThreads tasks within Mozilla.
-  bool isInterrupted() { return false; }
+  bool isInterrupted();
 
   bool runtimeMatches(JSRuntime* rt) { return runtime == rt; }
 
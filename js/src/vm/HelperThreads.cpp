@@ -1124,6 +1124,17 @@ void DelazifyTask::runHelperThreadTask(AutoLockHelperThreadState& lock) {
   }
 }
 
+bool DelazifyTask::isInterrupted() {
+  if (++functionsInSlice <= FunctionsPerSlice) {
+    return false;
+  }
+  functionsInSlice = 0;
+
+  AutoLockHelperThreadState lock;
+  return !HelperThreadState().delazifyWorklist(lock).isEmpty() ||
+         !HelperThreadState().parseWorklist(lock).empty();
+}
+
 bool DelazifyTask::runTask(JSContext* cx) {
   stackLimit = GetStackLimit();
 
@@ -1141,7 +1152,8 @@ bool DelazifyTask::runTask(JSContext* cx) {
   // to use it, as it could be purged by a GC in the mean time.
   StencilScopeBindingCache scopeCache(merger);
 
-  while (!strategy->done() || isInterrupted()) {
+  functionsInSlice = 0;
+  while (!strategy->done() && !isInterrupted()) {
     RefPtr<CompilationStencil> innerStencil;
     ScriptIndex scriptIndex = strategy->next();
     {
@@ -1965,8 +1977,10 @@ size_t GlobalHelperThreadState::maxCompressionThreads() const {
   }
 
   // Compression is triggered on major GCs to compress ScriptSources. It is
-  // considered low priority work.
-  return 1;
+  // considered low priority work, so use at most half of the helper threads.
+  // Each task compresses a separate source so they can run in parallel, which
+  // matters when a page loads many large scripts at once.
+  return std::max(std::min(cpuCount, threadCount) / 2, size_t(1));
 }
 
 size_t GlobalHelperThreadState::maxGCParallelThreads(
@@ -101,6 +101,58 @@ bool JSONParserBase::errorReturn() {
   return parseType == ParseType::AttemptForEval;
 }
 
+// Helpers for testing several characters at once by packing them into a
+// uint64_t, with one lane per character.
+template <typename CharT>
+struct CharLanes {
+  static_assert(sizeof(CharT) == 1 || sizeof(CharT) == 2);
+  static constexpr size_t Count = sizeof(uint64_t) / sizeof(CharT);
+  static constexpr uint64_t Ones =
+      sizeof(CharT) == 1 ? 0x0101010101010101 : 0x0001000100010001;
+  static constexpr uint64_t HighBits = Ones << (8 * sizeof(CharT) - 1);
+
+  static MOZ_ALWAYS_INLINE uint64_t load(const CharT* ptr) {
+    uint64_t word;
+    memcpy(&word, ptr, sizeof(word));
+    return word;
+  }
+
+  // Whether any lane of |word| holds a value less than |n|, which must not
+  // exceed the value of a lane's high bit. Borrows may flag lanes after a real
+  // hit, but there are no false positives when no lane matches.
+  static MOZ_ALWAYS_INLINE bool anyLessThan(uint64_t word, uint64_t n) {
+    return ((word - n * Ones) & ~word & HighBits) != 0;
+  }
+
+  static MOZ_ALWAYS_INLINE bool anyEqual(uint64_t word, uint64_t c) {
+    return anyLessThan(word ^ (c * Ones), 1);
+  }
+};
+
+// Return a pointer to the first character in [ptr, end) that ends a run of
+// plain string characters (a quote, a backslash or a control character), or
+// |end| if there is none.
+template <typename CharT>
+static MOZ_ALWAYS_INLINE const CharT* SkipPlainStringChars(const CharT* ptr,
+                                                           const CharT* end) {
+  using Lanes = CharLanes<CharT>;
+  while (size_t(end - ptr) >= Lanes::Count) {
+    uint64_t word = Lanes::load(ptr);
+    if (Lanes::anyEqual(word, '"') || Lanes::anyEqual(word, '\\') ||
+        Lanes::anyLessThan(word, 0x20)) {
+      break;
+    }
+    ptr += Lanes::Count;
+  }
+
+  for (; ptr < end; ptr++) {
+    if (*ptr == '"' || *ptr == '\\' || *ptr <= 0x001F) {
+      break;
+    }
+  }
+  return ptr;
+}
+
 template <typename CharT>
 template <JSONParserBase::StringType ST>
 JSONParserBase::Token JSONParser<CharT>::readString() {
@@ -122,7 +174,8 @@ JSONParserBase::Token JSONParser<CharT>::readString() {
    * string directly from the source text.
    */
   CharPtr start = current;
-  for (; current < end; current++) {
+  current += SkipPlainStringChars(current.get(), end.get()) - current.get();
+  if (current < end) {
     if (*current == '"') {
       size_t length = current - start;
       current++;
@@ -136,10 +189,6 @@ JSONParserBase::Token JSONParser<CharT>::readString() {
       return stringToken(str);
     }
 
-    if (*current == '\\') {
-      break;
-    }
-
     if (*current <= 0x001F) {
       error("bad control character in string literal");
       return token(Error);
@@ -246,11 +295,7 @@ JSONParserBase::Token JSONParser<CharT>::readString() {
     }
 
     start = current;
-    for (; current < end; current++) {
-      if (*current == '"' || *current == '\\' || *current <= 0x001F) {
-        break;
-      }
-    }
+    current += SkipPlainStringChars(current.get(), end.get()) - current.get();
   } while (current < end);
 
   error("unterminated string");
@@ -360,10 +405,24 @@ static inline bool IsJSONWhitespace(char16_t c) {
 }
 
 template <typename CharT>
-JSONParserBase::Token JSONParser<CharT>::advance() {
+void JSONParser<CharT>::skipWhitespace() {
+  // Pretty-printed JSON has long runs of indentation, so skip whole words of
+  // spaces before checking characters individually.
+  using Lanes = CharLanes<CharT>;
+  constexpr uint64_t Spaces = ' ' * Lanes::Ones;
+  while (end - current >= Lanes::Count &&
+         Lanes::load(current.get()) == Spaces) {
+    current += Lanes::Count;
+  }
+
   while (current < end && IsJSONWhitespace(*current)) {
     current++;
   }
+}
+
+template <typename CharT>
+JSONParserBase::Token JSONParser<CharT>::advance() {
+  skipWhitespace();
   if (current >= end) {
     error("unexpected end of data");
     return token(Error);
@@ -445,9 +504,7 @@ template <typename CharT>
 JSONParserBase::Token JSONParser<CharT>::advanceAfterObjectOpen() {
   MOZ_ASSERT(current[-1] == '{');
 
-  while (current < end && IsJSONWhitespace(*current)) {
-    current++;
-  }
+  skipWhitespace();
   if (current >= end) {
     error("end of data while reading object contents");
     return token(Error);
@@ -487,9 +544,7 @@ template <typename CharT>
 JSONParserBase::Token JSONParser<CharT>::advanceAfterArrayElement() {
   AssertPastValue(current);
 
-  while (current < end && IsJSONWhitespace(*current)) {
-    current++;
-  }
+  skipWhitespace();
   if (current >= end) {
     error("end of data when ',' or ']' was expected");
     return token(Error);
@@ -513,9 +568,7 @@ template <typename CharT>
 JSONParserBase::Token JSONParser<CharT>::advancePropertyName() {
   MOZ_ASSERT(current[-1] == ',');
 
-  while (current < end && IsJSONWhitespace(*current)) {
-    current++;
-  }
+  skipWhitespace();
   if (current >= end) {
     error("end of data when property name was expected");
     return token(Error);
@@ -533,9 +586,7 @@ template <typename CharT>
 JSONParserBase::Token JSONParser<CharT>::advancePropertyColon() {
   MOZ_ASSERT(current[-1] == '"');
 
-  while (current < end && IsJSONWhitespace(*current)) {
-    current++;
-  }
+  skipWhitespace();
   if (current >= end) {
     error("end of data after property name when ':' was expected");
     return token(Error);
@@ -554,9 +605,7 @@ template <typename CharT>
 JSONParserBase::Token JSONParser<CharT>::advanceAfterProperty() {
   AssertPastValue(current);
 
-  while (current < end && IsJSONWhitespace(*current)) {
-    current++;
-  }
+  skipWhitespace();
   if (current >= end) {
     error("end of data after property value in object");
     return token(Error);
@@ -254,6 +254,8 @@ class MOZ_STACK_CLASS JSONParser : public JSONParserBase {
 
   Token readNumber();
 
+  void skipWhitespace();
+
   Token advance();
   Token advancePropertyName();
   Token advancePropertyColon();
@@ -680,6 +680,11 @@ class NativeObject : public JSObject {
   [[nodiscard]] static bool toDictionaryMode(JSContext* cx,
                                              Handle<NativeObject*> obj);
 
+  // Switch a dictionary-mode object with no properties back to its initial
+  // shared shape. This is optional: on OOM the object is left unchanged.
+  static void maybeLeaveDictionaryModeWhenEmpty(JSContext* cx,
+                                                Handle<NativeObject*> obj);
+
  private:
   inline void setEmptyDynamicSlots(uint32_t dictonarySlotSpan);
 
@@ -307,6 +307,12 @@ bool RecordType::ensureAtomized(JSContext* cx) {
 
 bool RecordType::sameValueZero(JSContext* cx, RecordType* lhs, RecordType* rhs,
                                bool* equal) {
+  // Atomized records (e.g. ones used as Map or Set keys) can be compared
+  // without rooting or flattening anything.
+  if (lhs->isAtomized() && rhs->isAtomized()) {
+    *equal = sameValueZero(lhs, rhs);
+    return true;
+  }
   return sameValueWith<SameValueZero>(cx, lhs, rhs, equal);
 }
 
@@ -379,7 +385,7 @@ bool RecordType::sameValueWith(JSContext* cx, RecordType* lhs, RecordType* rhs,
   }
 
   *equal = true;
-  RootedString k1(cx), k2(cx);
+  Rooted<JSAtom*> key(cx);
   RootedId id(cx);
   RootedValue v1(cx), v2(cx);
 
@@ -389,19 +395,15 @@ bool RecordType::sameValueWith(JSContext* cx, RecordType* lhs, RecordType* rhs,
       cx, &rhs->getFixedSlot(SORTED_KEYS_SLOT).toObject().as<ArrayObject>());
 
   for (uint32_t index = 0; index < length; index++) {
-    k1.set(sortedKeysLHS->getDenseElement(index).toString());
-    k2.set(sortedKeysRHS->getDenseElement(index).toString());
-
-    if (!EqualStrings(cx, k1, k2, equal)) {
-      return false;
-    }
-    if (!*equal) {
+    // Keys are always atomized by initializeNextProperty, so they can be
+    // compared by pointer and don't need to be atomized again to get their id.
+    key = &sortedKeysLHS->getDenseElement(index).toString()->asAtom();
+    if (key != &sortedKeysRHS->getDenseElement(index).toString()->asAtom()) {
+      *equal = false;
       return true;
     }
 
-    if (!JS_StringToId(cx, k1, &id)) {
-      return false;
-    }
+    id = AtomToId(key);
 
     // We already know that this is an own property of both records, so both
     // calls must return true.
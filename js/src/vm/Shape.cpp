@@ -15,6 +15,7 @@
 #include "js/UniquePtr.h"
 #include "vm/JSContext.h"
 #include "vm/JSObject.h"
+#include "vm/PlainObject.h"  // js::PlainObject
 #include "vm/ShapeZone.h"
 #include "vm/Watchtower.h"
 
@@ -705,6 +706,40 @@ void NativeObject::maybeFreeDictionaryPropSlots(JSContext* cx,
   map->setFreeList(SHAPE_INVALID_SLOT);
 }
 
+/* static */
+void NativeObject::maybeLeaveDictionaryModeWhenEmpty(
+    JSContext* cx, Handle<NativeObject*> obj) {
+  MOZ_ASSERT(obj->inDictionaryMode());
+  MOZ_ASSERT(obj->shape()->propMapLength() == 0);
+
+  // Restrict this to plain objects. Other classes may rely on their dictionary
+  // shape, for example prototypes used for shape teleporting.
+  if (!obj->is<PlainObject>() || obj->isUsedAsPrototype()) {
+    return;
+  }
+
+  // Free all non-reserved slots so that the slot capacity matches the slot
+  // span of the initial shape.
+  DictionaryPropMap* map = obj->shape()->dictionaryPropMap();
+  obj->maybeFreeDictionaryPropSlots(cx, map, 0);
+  MOZ_ASSERT(obj->dictionaryModeSlotSpan() ==
+             JSCLASS_RESERVED_SLOTS(obj->getClass()));
+
+  Shape* shape = obj->shape();
+  Shape* newShape = SharedShape::getInitialShape(
+      cx, shape->getObjectClass(), shape->realm(), shape->proto(),
+      shape->numFixedSlots(), shape->objectFlags());
+  if (!newShape) {
+    cx->recoverFromOutOfMemory();
+    return;
+  }
+
+  obj->setDictionaryModeSlotSpan(0);
+  obj->setShape(newShape);
+  MOZ_ASSERT(!obj->inDictionaryMode());
+  MOZ_ASSERT(obj->numDynamicSlots() == obj->calculateDynamicSlots());
+}
+
 void NativeObject::setShapeAndRemoveLastSlot(JSContext* cx, Shape* newShape,
                                              uint32_t slot) {
   MOZ_ASSERT(!inDictionaryMode());
@@ -846,7 +881,17 @@ bool NativeObject::removeProperty(JSContext* cx, Handle<NativeObject*> obj,
   // slots repeatedly.
   static constexpr size_t MinSlotSpanForFree = 64;
   if (obj->dictionaryModeSlotSpan() >= MinSlotSpanForFree) {
-    obj->maybeFreeDictionaryPropSlots(cx, dictMap, mapLength);
+    // Objects used as hash maps often end up with all their properties
+    // deleted. Don't keep a dictionary shape and map alive for them either.
+    // This uses the same threshold as freeing the slots, so that small
+    // objects that are filled and drained in a loop don't churn between
+    // dictionary and shared shapes.
+    if (mapLength == 0) {
+      NativeObject::maybeLeaveDictionaryModeWhenEmpty(cx, obj);
+    }
+    if (obj->inDictionaryMode()) {
+      obj->maybeFreeDictionaryPropSlots(cx, dictMap, mapLength);
+    }
   }
 
   return true;
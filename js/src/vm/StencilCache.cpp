@@ -6,6 +6,8 @@
 
 #include "vm/StencilCache.h"
 
+#include <utility>  // std::move
+
 #include "frontend/CompilationStencil.h"
 #include "js/experimental/JSStencil.h"
 #include "vm/MutexIDs.h"
@@ -60,8 +62,16 @@ bool js::StencilCache::putNew(AccessKey& guard, const StencilContext& key,
 // Important: This function should not be called within a scope checking for
 // isSourceCached, as this would cause a dead-lock.
 void js::StencilCache::clearAndDisable() {
-  auto guard = cache.lock();
-  guard->functions.clearAndCompact();
-  guard->watched.clearAndCompact();
-  enabled = false;
+  // Move the content of the cache out of the lock before releasing it. The
+  // cache can hold a large number of stencils, and freeing them while holding
+  // the lock would stall any delazification task waiting to check
+  // isSourceCached, only to find out that the cache is now disabled.
+  StencilMap functions;
+  SourceSet watched;
+  {
+    auto guard = cache.lock();
+    functions = std::move(guard->functions);
+    watched = std::move(guard->watched);
+    enabled = false;
+  }
 }
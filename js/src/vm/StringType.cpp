@@ -553,11 +553,15 @@ void JSRope::dumpRepresentation(js::GenericPrinter& out, int indent) const {
 
 namespace js {
 
+// Rope flattening calls these for every leaf, and leaves are usually shorter
+// than the 128 elements below which PodCopy falls back to an element-wise
+// loop. Use memcpy directly, which handles short copies with wide moves.
+
 template <>
 void CopyChars(char16_t* dest, const JSLinearString& str) {
   AutoCheckCannotGC nogc;
   if (str.hasTwoByteChars()) {
-    PodCopy(dest, str.twoByteChars(nogc), str.length());
+    memcpy(dest, str.twoByteChars(nogc), str.length() * sizeof(char16_t));
   } else {
     CopyAndInflateChars(dest, str.latin1Chars(nogc), str.length());
   }
@@ -567,7 +571,7 @@ template <>
 void CopyChars(Latin1Char* dest, const JSLinearString& str) {
   AutoCheckCannotGC nogc;
   if (str.hasLatin1Chars()) {
-    PodCopy(dest, str.latin1Chars(nogc), str.length());
+    memcpy(dest, str.latin1Chars(nogc), str.length() * sizeof(Latin1Char));
   } else {
     /*
      * When we flatten a TwoByte rope, we turn child ropes (including Latin1
@@ -58,6 +58,7 @@
 #include "util/DifferentialTesting.h"
 #include "vm/BigIntType.h"
 #include "vm/ErrorObject.h"
+#include "vm/JSAtom.h"
 #include "vm/JSContext.h"
 #include "vm/PlainObject.h"  // js::PlainObject
 #include "vm/RegExpObject.h"
@@ -448,6 +449,12 @@ struct JSStructuredCloneReader {
   template <typename CharT>
   JSString* readStringImpl(uint32_t nchars, gc::InitialHeap heap);
   JSString* readString(uint32_t data, gc::InitialHeap heap = gc::DefaultHeap);
+  template <typename CharT>
+  JSAtom* readAtomImpl(uint32_t nchars);
+  JSAtom* readAtom(uint32_t data);
+
+  // Read the key of a plain object or array property.
+  [[nodiscard]] bool readPropertyKey(MutableHandleValue vp);
 
   BigInt* readBigInt(uint32_t data);
 
@@ -2476,6 +2483,54 @@ JSString* JSStructuredCloneReader::readString(uint32_t data,
                 : readStringImpl<char16_t>(nchars, heap);
 }
 
+template <typename CharT>
+JSAtom* JSStructuredCloneReader::readAtomImpl(uint32_t nchars) {
+  if (nchars > JSString::MAX_LENGTH) {
+    JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                              JSMSG_SC_BAD_SERIALIZED_DATA, "string length");
+    return nullptr;
+  }
+
+  InlineCharBuffer<CharT> chars;
+  if (!chars.maybeAlloc(context(), nchars) ||
+      !in.readChars(chars.get(), nchars)) {
+    return nullptr;
+  }
+  return AtomizeChars(context(), chars.get(), nchars);
+}
+
+JSAtom* JSStructuredCloneReader::readAtom(uint32_t data) {
+  uint32_t nchars = data & BitMask(31);
+  bool latin1 = data & (1 << 31);
+  return latin1 ? readAtomImpl<Latin1Char>(nchars)
+                : readAtomImpl<char16_t>(nchars);
+}
+
+bool JSStructuredCloneReader::readPropertyKey(MutableHandleValue vp) {
+  uint32_t tag, data;
+  if (!in.getPair(&tag, &data)) {
+    return false;
+  }
+
+  if (tag != SCTAG_STRING) {
+    return startRead(vp);
+  }
+
+  // Property keys are atomized when the property is defined. Atomize the
+  // characters directly instead of allocating a string which would be
+  // discarded right away. Objects of the same shape repeat the same keys, so
+  // this also hits the atom caches instead of hashing a fresh string.
+  MOZ_ALWAYS_TRUE(in.readPair(&tag, &data));
+  numItemsRead++;
+
+  JSAtom* atom = readAtom(data);
+  if (!atom) {
+    return false;
+  }
+  vp.setString(atom);
+  return true;
+}
+
 [[nodiscard]] bool JSStructuredCloneReader::readUint32(uint32_t* num) {
   Rooted<Value> lineVal(context());
   if (!startRead(&lineVal)) {
@@ -3752,7 +3807,11 @@ bool JSStructuredCloneReader::read(MutableHandleValue vp, size_t nbytes) {
     // Note that this means the ordering in the stream is a little funky for
     // things like Map. See the comment above traverseMap() for an example.
     RootedValue key(context());
-    if (!startRead(&key)) {
+    if (obj->is<PlainObject>() || obj->is<ArrayObject>()) {
+      if (!readPropertyKey(&key)) {
+        return false;
+      }
+    } else if (!startRead(&key)) {
       return false;
     }
 
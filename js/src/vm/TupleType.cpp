@@ -384,6 +384,12 @@ bool TupleType::ensureAtomized(JSContext* cx) {
 
 bool TupleType::sameValueZero(JSContext* cx, TupleType* lhs, TupleType* rhs,
                               bool* equal) {
+  // Atomized tuples (e.g. ones used as Map or Set keys) can be compared
+  // without rooting or flattening anything.
+  if (lhs->isAtomized() && rhs->isAtomized()) {
+    *equal = sameValueZero(lhs, rhs);
+    return true;
+  }
   return sameValueWith<SameValueZero>(cx, lhs, rhs, equal);
 }
 
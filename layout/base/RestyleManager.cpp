@@ -3018,10 +3018,10 @@ bool RestyleManager::ProcessPostTraversalForText(
 }
 
 void RestyleManager::ClearSnapshots() {
-  for (auto iter = mSnapshots.Iter(); !iter.Done(); iter.Next()) {
-    iter.Key()->UnsetFlags(ELEMENT_HAS_SNAPSHOT | ELEMENT_HANDLED_SNAPSHOT);
-    iter.Remove();
+  for (Element* element : mSnapshots.Keys()) {
+    element->UnsetFlags(ELEMENT_HAS_SNAPSHOT | ELEMENT_HANDLED_SNAPSHOT);
   }
+  mSnapshots.Clear();
 }
 
 ServoElementSnapshot& RestyleManager::SnapshotFor(Element& aElement) {
@@ -3040,13 +3040,12 @@ ServoElementSnapshot& RestyleManager::SnapshotFor(Element& aElement) {
   MOZ_ASSERT(aElement.HasServoData());
   MOZ_ASSERT(!aElement.HasFlag(ELEMENT_HANDLED_SNAPSHOT));
 
-  ServoElementSnapshot* snapshot =
-      mSnapshots.GetOrInsertNew(&aElement, aElement);
+  ServoElementSnapshot& snapshot = mSnapshots.GetOrCreate(aElement);
   aElement.SetFlags(ELEMENT_HAS_SNAPSHOT);
 
   // Now that we have a snapshot, make sure a restyle is triggered.
   aElement.NoteDirtyForServo();
-  return *snapshot;
+  return snapshot;
 }
 
 void RestyleManager::DoProcessPendingRestyles(ServoTraversalFlags aFlags) {
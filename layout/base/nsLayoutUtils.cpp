@@ -3511,20 +3511,30 @@ void nsLayoutUtils::PaintFrame(gfxContext* aRenderingContext, nsIFrame* aFrame,
     }
   }
 
-#if 0
-  if (XRE_IsParentProcess()) {
+  // Only retained display lists record partial-build metrics; a temporary
+  // builder's metrics were destroyed along with it above.
+  if (retainedBuilder && profiler_thread_is_being_profiled_for_markers()) {
     if (metrics->mPartialUpdateResult == PartialUpdateResult::Failed) {
-      printf("DL partial update failed: %s, Frame: %p\n",
-             metrics->FailReasonString(), aFrame);
+      PROFILER_MARKER_TEXT(
+          "DisplayListBuild", GRAPHICS, {},
+          nsPrintfCString("Full build (partial update failed: %s), modified "
+                          "frames: %u, partial: %.2fms, full: %.2fms",
+                          metrics->FailReasonString(),
+                          metrics->mModifiedFrames,
+                          metrics->mPartialBuildDuration,
+                          metrics->mFullBuildDuration));
     } else {
-      printf(
-          "DL partial build success!"
-          " new: %d, reused: %d, rebuilt: %d, removed: %d, total: %d\n",
-          metrics->mNewItems, metrics->mReusedItems, metrics->mRebuiltItems,
-          metrics->mRemovedItems, metrics->mTotalItems);
+      PROFILER_MARKER_TEXT(
+          "DisplayListBuild", GRAPHICS, {},
+          nsPrintfCString("Partial build, modified frames: %u, new: %u, "
+                          "reused: %u, rebuilt: %u, removed: %u, total: %u, "
+                          "duration: %.2fms",
+                          metrics->mModifiedFrames, metrics->mNewItems,
+                          metrics->mReusedItems, metrics->mRebuiltItems,
+                          metrics->mRemovedItems, metrics->mTotalItems,
+                          metrics->mPartialBuildDuration));
     }
   }
-#endif
 }
 
 /**
@@ -204,6 +204,22 @@ CharT* nsTextFrameUtils::TransformText(const CharT* aText, uint32_t aLength,
     // Skip discardables.
     uint32_t i;
     for (i = 0; i < aLength; ++i) {
+      if constexpr (sizeof(CharT) == 1) {
+        // Copy runs of 1-byte text that need no transformation in one go.
+        // No 1-byte character is Arabic.
+        uint32_t end = i;
+        while (end < aLength && aText[end] > ' ' && aText[end] != CH_SHY) {
+          ++end;
+        }
+        if (end > i) {
+          memcpy(aOutput, aText + i, end - i);
+          aOutput += end - i;
+          aSkipChars->KeepChars(end - i);
+          lastCharArabic = false;
+          i = end - 1;
+          continue;
+        }
+      }
       CharT ch = aText[i];
       if (IsDiscardable(ch, &flags)) {
         aSkipChars->SkipChar();
@@ -234,6 +250,24 @@ CharT* nsTextFrameUtils::TransformText(const CharT* aText, uint32_t aLength,
     bool inWhitespace = (*aIncomingFlags & INCOMING_WHITESPACE) != 0;
     uint32_t i;
     for (i = 0; i < aLength; ++i) {
+      if constexpr (sizeof(CharT) == 1) {
+        // Copy runs of 1-byte text other than white space and soft hyphens in
+        // one go. No 1-byte character is Arabic.
+        uint32_t end = i;
+        while (end < aLength && !IsSpaceOrTabOrSegmentBreak(aText[end]) &&
+               aText[end] != CH_SHY) {
+          ++end;
+        }
+        if (end > i) {
+          memcpy(aOutput, aText + i, end - i);
+          aOutput += end - i;
+          aSkipChars->KeepChars(end - i);
+          lastCharArabic = false;
+          inWhitespace = false;
+          i = end - 1;
+          continue;
+        }
+      }
       CharT ch = aText[i];
       // CSS Text 3 - 4.1. The White Space Processing Rules
       // White space processing in CSS affects only the document white space
@@ -1589,6 +1589,7 @@ PartialUpdateResult RetainedDisplayListBuilder::AttemptPartialUpdate(
   AutoClearFramePropsArray framesWithProps(64);
   GetModifiedAndFramesWithProps(&modifiedFrames.Frames(),
                                 &framesWithProps.Frames());
+  Metrics()->mModifiedFrames = modifiedFrames.Frames().Length();
 
   if (!ShouldBuildPartial(modifiedFrames.Frames())) {
     // Do not allow partial builds if the |ShouldBuildPartial()| heuristic
@@ -108,6 +108,7 @@ struct RetainedDisplayListMetrics {
     mRemovedItems = 0;
     mReusedItems = 0;
     mTotalItems = 0;
+    mModifiedFrames = 0;
     mPartialBuildDuration = 0;
     mFullBuildDuration = 0;
     mPartialUpdateFailReason = PartialUpdateFailReason::NA;
@@ -153,6 +154,7 @@ struct RetainedDisplayListMetrics {
   unsigned int mRemovedItems;
   unsigned int mReusedItems;
   unsigned int mTotalItems;
+  unsigned int mModifiedFrames;
 
   mozilla::TimeStamp mStartTime;
   double mPartialBuildDuration;
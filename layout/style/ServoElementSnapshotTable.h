@@ -8,15 +8,45 @@
 #define mozilla_ServoElementSnapshotTable_h
 
 #include "mozilla/dom/Element.h"
-#include "nsClassHashtable.h"
+#include "mozilla/SegmentedVector.h"
 #include "nsHashKeys.h"
+#include "nsTHashMap.h"
 #include "ServoElementSnapshot.h"
 
 namespace mozilla {
 
-class ServoElementSnapshotTable
-    : public nsClassHashtable<nsRefPtrHashKey<dom::Element>,
-                              ServoElementSnapshot> {};
+// Maps elements to the snapshot of their state and attributes before the
+// changes that are pending a restyle.
+//
+// The snapshots themselves are allocated in segments rather than one by one,
+// since a single class toggle can need snapshots for thousands of elements,
+// and they are all thrown away together after the restyle.
+class ServoElementSnapshotTable {
+ public:
+  ServoElementSnapshot* Get(dom::Element* aElement) const {
+    return mTable.Get(aElement);
+  }
+
+  ServoElementSnapshot& GetOrCreate(dom::Element& aElement) {
+    return *mTable.LookupOrInsertWith(&aElement, [&] {
+      mSnapshots.InfallibleAppend(aElement);
+      return &mSnapshots.GetLast();
+    });
+  }
+
+  bool IsEmpty() const { return mTable.IsEmpty(); }
+  uint32_t Count() const { return mTable.Count(); }
+  auto Keys() const { return mTable.Keys(); }
+
+  void Clear() {
+    mTable.Clear();
+    mSnapshots.Clear();
+  }
+
+ private:
+  nsTHashMap<nsRefPtrHashKey<dom::Element>, ServoElementSnapshot*> mTable;
+  SegmentedVector<ServoElementSnapshot, 4096> mSnapshots;
+};
 
 }  // namespace mozilla
 
@@ -16,9 +16,11 @@
 #include "mozilla/LookAndFeel.h"
 #include "mozilla/PresShell.h"
 #include "mozilla/ProfilerLabels.h"
+#include "mozilla/ProfilerMarkers.h"
 #include "mozilla/ServoBindings.h"
 #include "mozilla/RestyleManager.h"
 #include "mozilla/ServoStyleRuleMap.h"
+#include "mozilla/ServoTraversalStatistics.h"
 #include "mozilla/ServoTypes.h"
 #include "mozilla/SMILAnimationController.h"
 #include "mozilla/MediaFeatureChange.h"
@@ -757,6 +759,31 @@ bool ServoStyleSet::GeneratedContentPseudoExists(
   return true;
 }
 
+// Reports the statistics stylo collected for the traversal that just ran, if
+// any. The statistics are only gathered while ServoTraversalStatistics::sActive
+// is set, so this costs nothing in the common case.
+static void MaybeAddTraversalStatisticsMarker(ServoTraversalFlags aFlags) {
+  if (!ServoTraversalStatistics::sActive ||
+      !profiler_thread_is_being_profiled_for_markers()) {
+    return;
+  }
+  const ServoTraversalStatistics& stats = ServoTraversalStatistics::sSingleton;
+  double sharedPercent =
+      stats.mElementsStyled
+          ? 100.0 * stats.mStylesShared / stats.mElementsStyled
+          : 0.0;
+  PROFILER_MARKER_TEXT(
+      "StyleTraversal", LAYOUT, {},
+      nsPrintfCString(
+          "%s, traversed %u, styled %u, matched %u, shared %u (%.1f%%), "
+          "reused %u",
+          (aFlags & ServoTraversalFlags::ParallelTraversal) ? "parallel"
+                                                            : "sequential",
+          stats.mElementsTraversed, stats.mElementsStyled,
+          stats.mElementsMatched, stats.mStylesShared, sharedPercent,
+          stats.mStylesReused));
+}
+
 bool ServoStyleSet::StyleDocument(ServoTraversalFlags aFlags) {
   AUTO_PROFILER_LABEL_CATEGORY_PAIR_RELEVANT_FOR_JS(LAYOUT_StyleComputation);
   MOZ_ASSERT(GetPresContext(), "Styling a document without a shell?");
@@ -793,6 +820,7 @@ bool ServoStyleSet::StyleDocument(ServoTraversalFlags aFlags) {
         Servo_TraverseSubtree(root, mRawSet.get(), &snapshots, aFlags);
     postTraversalRequired |= root->HasAnyOfFlags(
         Element::kAllServoDescendantBits | NODE_NEEDS_FRAME);
+    MaybeAddTraversalStatisticsMarker(aFlags);
 
     {
       uint32_t existingBits = mDocument->GetServoRestyleRootDirtyBits();
@@ -838,6 +866,7 @@ bool ServoStyleSet::StyleDocument(ServoTraversalFlags aFlags) {
         Servo_TraverseSubtree(root, mRawSet.get(), &snapshots, aFlags);
     postTraversalRequired |= root->HasAnyOfFlags(
         Element::kAllServoDescendantBits | NODE_NEEDS_FRAME);
+    MaybeAddTraversalStatisticsMarker(aFlags);
   }
 
   return postTraversalRequired;
@@ -1288,6 +1288,15 @@ static const bool opt_zero = false;
 #endif
 static bool opt_randomize_small = true;
 
+#if defined(XP_LINUX) && defined(MADV_HUGEPAGE)
+#  define MALLOC_HUGE_PAGES
+// When set (MALLOC_OPTIONS contains 'H'), huge allocations that can hold at
+// least one transparent huge page are aligned to kHugePageSize and advised
+// with MADV_HUGEPAGE, so that large long-lived buffers use fewer TLB entries.
+static bool opt_huge_pages = false;
+static const size_t kHugePageSize = 2_MiB;
+#endif
+
 // ***************************************************************************
 // Begin forward declarations.
 
@@ -3926,6 +3935,16 @@ void* arena_t::PallocHuge(size_t aSize, size_t aAlignment, bool aZero) {
     return nullptr;
   }
 
+#ifdef MALLOC_HUGE_PAGES
+  // Line the allocation up with huge pages. The kernel can only back the
+  // 2 MiB-aligned parts of a mapping with huge pages, and chunks are only
+  // aligned to kChunkSize.
+  bool useHugePages = opt_huge_pages && csize >= kHugePageSize;
+  if (useHugePages) {
+    aAlignment = std::max(aAlignment, kHugePageSize);
+  }
+#endif
+
   // Allocate one or more contiguous chunks for this request.
   ret = chunk_alloc(csize, aAlignment, false, &zeroed);
   if (!ret) {
@@ -3933,6 +3952,16 @@ void* arena_t::PallocHuge(size_t aSize, size_t aAlignment, bool aZero) {
     return nullptr;
   }
   psize = PAGE_CEILING(aSize);
+#ifdef MALLOC_HUGE_PAGES
+  if (useHugePages) {
+    // Only advise the whole huge pages that will stay committed; the tail
+    // past psize is decommitted below.
+    size_t hugeSize = psize & ~(kHugePageSize - 1);
+    if (hugeSize) {
+      madvise(ret, hugeSize, MADV_HUGEPAGE);
+    }
+  }
+#endif
   if (aZero) {
     // We will decommit anything past psize so there is no need to zero
     // further.
@@ -4193,6 +4222,14 @@ static bool malloc_init_hard() {
             }
             break;
 #  endif
+#endif
+#ifdef MALLOC_HUGE_PAGES
+          case 'h':
+            opt_huge_pages = false;
+            break;
+          case 'H':
+            opt_huge_pages = true;
+            break;
 #endif
           case 'r':
             opt_randomize_small = false;
@@ -410,10 +410,11 @@ nsZipItem* nsZipArchive::GetItem(const char* aEntryName) {
       }
     }
     MMAP_FAULT_HANDLER_BEGIN_HANDLE(mFd)
-    nsZipItem* item = mFiles[HashName(aEntryName, len)];
+    uint32_t hash = HashName(aEntryName, len);
+    nsZipItem* item = mFiles[hash % ZIP_TABSIZE];
     while (item) {
-      if ((len == item->nameLength) &&
-          (!memcmp(aEntryName, item->Name(), len))) {
+      if (hash == item->nameHash && len == item->nameLength &&
+          !memcmp(aEntryName, item->Name(), len)) {
         // Successful GetItem() is a good indicator that the file is about to be
         // read
         if (mUseZipLog && mURI.Length()) {
@@ -667,15 +668,16 @@ nsresult nsZipArchive::BuildFileList(PRFileDesc* aFd)
     item->central = central;
     item->nameLength = namelen;
     item->isSynthetic = false;
+    item->nameHash = HashName(item->Name(), namelen);
 
     // Add item to file table
 #ifdef DEBUG
     nsDependentCSubstring name(item->Name(), namelen);
     LOG(("   %s", PromiseFlatCString(name).get()));
 #endif
-    uint32_t hash = HashName(item->Name(), namelen);
-    item->next = mFiles[hash];
-    mFiles[hash] = item;
+    uint32_t bucket = item->nameHash % ZIP_TABSIZE;
+    item->next = mFiles[bucket];
+    mFiles[bucket] = item;
 
     sig = 0;
   } /* while reading central directory records */
@@ -723,10 +725,11 @@ nsresult nsZipArchive::BuildSynthetics() {
 
         // Is the directory already in the file table?
         uint32_t hash = HashName(item->Name(), dirlen);
+        uint32_t bucket = hash % ZIP_TABSIZE;
         bool found = false;
-        for (nsZipItem* zi = mFiles[hash]; zi != nullptr; zi = zi->next) {
-          if ((dirlen == zi->nameLength) &&
-              (0 == memcmp(item->Name(), zi->Name(), dirlen))) {
+        for (nsZipItem* zi = mFiles[bucket]; zi != nullptr; zi = zi->next) {
+          if (hash == zi->nameHash && dirlen == zi->nameLength &&
+              0 == memcmp(item->Name(), zi->Name(), dirlen)) {
             // we've already added this dir and all its parents
             found = true;
             break;
@@ -744,10 +747,11 @@ nsresult nsZipArchive::BuildSynthetics() {
         diritem->central = item->central;
         diritem->nameLength = dirlen;
         diritem->isSynthetic = true;
+        diritem->nameHash = hash;
 
         // add diritem to the file table
-        diritem->next = mFiles[hash];
-        mFiles[hash] = diritem;
+        diritem->next = mFiles[bucket];
+        mFiles[bucket] = diritem;
       } /* end processing of dirs in item's name */
     }
   }
@@ -923,7 +927,8 @@ nsZipFind::~nsZipFind() {
 /*
  * HashName
  *
- * returns a hash key for the entry name
+ * returns a hash key for the entry name; callers reduce it modulo
+ * ZIP_TABSIZE to get the bucket.
  */
 MOZ_NO_SANITIZE_UNSIGNED_OVERFLOW
 static uint32_t HashName(const char* aName, uint16_t len) {
@@ -936,7 +941,7 @@ static uint32_t HashName(const char* aName, uint16_t len) {
     val = val * 37 + *p++;
   }
 
-  return (val % ZIP_TABSIZE);
+  return val;
 }
 
 /*
@@ -992,7 +997,11 @@ static PRTime GetModTime(uint16_t aDate, uint16_t aTime) {
 }
 
 nsZipItem::nsZipItem()
-    : next(nullptr), central(nullptr), nameLength(0), isSynthetic(false) {}
+    : next(nullptr),
+      central(nullptr),
+      nameLength(0),
+      isSynthetic(false),
+      nameHash(0) {}
 
 uint32_t nsZipItem::LocalOffset() { return xtolong(central->localhdr_offset); }
 
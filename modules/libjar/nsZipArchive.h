@@ -8,7 +8,7 @@
 
 #include "mozilla/Attributes.h"
 
-#define ZIP_TABSIZE 256
+#define ZIP_TABSIZE 1024
 #define ZIP_BUFLEN \
   (4 * 1024) /* Used as output buffer when deflating items to a file */
 
@@ -70,6 +70,10 @@ class nsZipItem final {
   const ZipCentral* central;
   uint16_t nameLength;
   bool isSynthetic;
+  // Full hash of the name, compared before the name itself so that walking a
+  // hash chain doesn't touch (and possibly fault in) the central directory
+  // record of every entry in it.
+  uint32_t nameHash;
 };
 
 class nsZipHandle;
@@ -230,6 +230,7 @@ static uint32_t AvailableFeatures() {
   ProfilerFeature::ClearJava(features);
   ProfilerFeature::ClearJS(features);
   ProfilerFeature::ClearScreenshots(features);
+  ProfilerFeature::ClearHardwareCounters(features);
 #if !defined(HAVE_NATIVE_UNWIND)
   ProfilerFeature::ClearStackWalk(features);
 #endif
@@ -234,7 +234,12 @@ class MOZ_RAII AutoProfilerStats {
     MACRO(21, "processcpu", ProcessCPU,                                      \
           "Sample the CPU utilization of each process")                      \
                                                                              \
-    MACRO(22, "power", Power, POWER_HELP)
+    MACRO(22, "power", Power, POWER_HELP)                                    \
+                                                                             \
+    MACRO(23, "hwcounters", HardwareCounters,                                \
+          "Record hardware performance counters with each thread sample. "   \
+          "Only available on Linux, may require lowering the sysctl "        \
+          "kernel.perf_event_paranoid")
 // *** Synchronize with lists in ProfilerState.h and geckoProfiler.json ***
 
 struct ProfilerFeature {
@@ -30,6 +30,7 @@
 #include "nsServiceManagerUtils.h"
 #include "nsStreamUtils.h"
 #include "nsString.h"
+#include "nsTHashSet.h"
 #include "nsThreadUtils.h"
 #include "mozilla/Logging.h"
 
@@ -1152,10 +1153,28 @@ bool Predictor::RunPredictions(nsIURI* referrer,
     }
   }
 
+  // Predictions are made per subresource, but preconnects and preresolves
+  // only care about the origin and host. A page pulling many resources from
+  // the same server would otherwise issue one speculative connection and one
+  // DNS lookup per resource. A preconnect resolves its host as well, so hosts
+  // we are preconnecting to don't need a separate preresolve.
+  nsTHashSet<nsCString> seenOrigins;
+  nsTHashSet<nsCString> seenHosts;
+
   len = preconnects.Length();
   for (i = 0; i < len; ++i) {
-    PREDICTOR_LOG(("    doing preconnect"));
     nsCOMPtr<nsIURI> uri = preconnects[i];
+    nsAutoCString prePath;
+    if (NS_SUCCEEDED(uri->GetPrePath(prePath)) &&
+        !seenOrigins.EnsureInserted(prePath)) {
+      PREDICTOR_LOG(("    skipping duplicate preconnect %s", prePath.get()));
+      continue;
+    }
+    nsAutoCString hostname;
+    if (NS_SUCCEEDED(uri->GetAsciiHost(hostname))) {
+      seenHosts.Insert(hostname);
+    }
+    PREDICTOR_LOG(("    doing preconnect"));
     ++totalPredictions;
     ++totalPreconnects;
     nsCOMPtr<nsIPrincipal> principal =
@@ -1171,10 +1190,14 @@ bool Predictor::RunPredictions(nsIURI* referrer,
   len = preresolves.Length();
   for (i = 0; i < len; ++i) {
     nsCOMPtr<nsIURI> uri = preresolves[i];
-    ++totalPredictions;
-    ++totalPreresolves;
     nsAutoCString hostname;
     uri->GetAsciiHost(hostname);
+    if (!seenHosts.EnsureInserted(hostname)) {
+      PREDICTOR_LOG(("    skipping duplicate preresolve %s", hostname.get()));
+      continue;
+    }
+    ++totalPredictions;
+    ++totalPreresolves;
     PREDICTOR_LOG(("    doing preresolve %s", hostname.get()));
     nsCOMPtr<nsICancelable> tmpCancelable;
     mDnsService->AsyncResolveNative(
@@ -194,7 +194,7 @@ SSLTokensCache::~SSLTokensCache() { LOG(("SSLTokensCache::~SSLTokensCache")); }
 nsresult SSLTokensCache::Put(const nsACString& aKey, const uint8_t* aToken,
                              uint32_t aTokenLen,
                              CommonSocketControl* aSocketControl) {
-  PRUint32 expirationTime;
+  PRTime expirationTime;
   SSLResumptionTokenInfo tokenInfo;
   if (SSL_GetResumptionTokenInfo(aToken, aTokenLen, &tokenInfo,
                                  sizeof(tokenInfo)) != SECSuccess) {
@@ -213,7 +213,7 @@ nsresult SSLTokensCache::Put(const nsACString& aKey, const uint8_t* aToken,
 nsresult SSLTokensCache::Put(const nsACString& aKey, const uint8_t* aToken,
                              uint32_t aTokenLen,
                              CommonSocketControl* aSocketControl,
-                             PRUint32 aExpirationTime) {
+                             PRTime aExpirationTime) {
   StaticMutexAutoLock lock(sLock);
 
   LOG(("SSLTokensCache::Put [key=%s, tokenLen=%u]",
@@ -389,6 +389,22 @@ nsresult SSLTokensCache::GetLocked(const nsACString& aKey,
       return NS_ERROR_NOT_AVAILABLE;
     }
 
+    // Records are sorted by expiration time. A server rejects an expired
+    // ticket anyway, so drop those rather than spend a round trip on them.
+    PRTime now = PR_Now();
+    while (cacheEntry->RecordCount() &&
+           cacheEntry->Get()->mExpirationTime <= now) {
+      LOG(("  dropping expired token [id=%" PRIu64 "]",
+           cacheEntry->Get()->mId));
+      mCacheSize -= cacheEntry->Get()->Size();
+      cacheEntry->RemoveWithId(cacheEntry->Get()->mId);
+    }
+    if (cacheEntry->RecordCount() == 0) {
+      mTokenCacheRecords.Remove(aKey);
+      LOG(("  all tokens expired"));
+      return NS_ERROR_NOT_AVAILABLE;
+    }
+
     const UniquePtr<TokenCacheRecord>& rec = cacheEntry->Get();
     aToken = rec->mToken.Clone();
     aResult = rec->mSessionCacheInfo.Clone();
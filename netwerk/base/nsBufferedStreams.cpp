@@ -419,6 +419,23 @@ nsBufferedInputStream::Read(char* buf, uint32_t count, uint32_t* result) {
     return rv;
   }
 
+  // If nothing is buffered and the caller wants at least a buffer's worth,
+  // read straight into the caller's buffer rather than filling ours and
+  // copying out of it.
+  if (mStream && mGetBufferCount == 0 && mCursor == mFillPoint &&
+      count >= mBufferSize) {
+    mBufferStartOffset += mCursor;
+    mCursor = mFillPoint = 0;
+    nsresult rv = Source()->Read(buf, count, result);
+    if (NS_SUCCEEDED(rv)) {
+      mBufferStartOffset += *result;  // so nsBufferedStream::Tell works
+      if (*result == 0) {
+        mEOF = true;
+      }
+    }
+    return rv;
+  }
+
   return ReadSegments(NS_CopySegmentToBuffer, buf, count, result);
 }
 
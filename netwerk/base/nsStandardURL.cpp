@@ -1658,16 +1658,18 @@ nsresult nsStandardURL::SetSpecWithEncoding(const nsACString& input,
   if (IsSpecialProtocol(filteredURI)) {
     // Bug 652186: Replace all backslashes with slashes when parsing paths
     // Stop when we reach the query or the hash.
-    auto* start = filteredURI.BeginWriting();
-    auto* end = filteredURI.EndWriting();
-    while (start != end) {
-      if (*start == '?' || *start == '#') {
-        break;
-      }
-      if (*start == '\\') {
-        *start = '/';
-      }
-      start++;
+    // filteredURI usually shares the caller's buffer, and BeginWriting()
+    // would copy it, so only ask for a writable buffer if there is
+    // something to replace.
+    const char* begin = filteredURI.BeginReading();
+    const char* stop =
+        std::find_if(begin, filteredURI.EndReading(),
+                     [](char aChar) { return aChar == '?' || aChar == '#'; });
+    const char* backslash = std::find(begin, stop, '\\');
+    if (backslash != stop) {
+      char* writable = filteredURI.BeginWriting();
+      std::replace(writable + (backslash - begin), writable + (stop - begin),
+                   '\\', '/');
     }
   }
 
@@ -70,21 +70,24 @@ nsresult CacheFileChunkBuffer::FillInvalidRanges(
   return NS_OK;
 }
 
-[[nodiscard]] nsresult CacheFileChunkBuffer::EnsureBufSize(uint32_t aBufSize) {
+[[nodiscard]] nsresult CacheFileChunkBuffer::EnsureBufSize(uint32_t aBufSize,
+                                                          bool aExact) {
   AssertOwnsLock();
 
   if (mBufSize >= aBufSize) {
     return NS_OK;
   }
 
-  // find smallest power of 2 greater than or equal to aBufSize
-  aBufSize--;
-  aBufSize |= aBufSize >> 1;
-  aBufSize |= aBufSize >> 2;
-  aBufSize |= aBufSize >> 4;
-  aBufSize |= aBufSize >> 8;
-  aBufSize |= aBufSize >> 16;
-  aBufSize++;
+  if (!aExact) {
+    // find smallest power of 2 greater than or equal to aBufSize
+    aBufSize--;
+    aBufSize |= aBufSize >> 1;
+    aBufSize |= aBufSize >> 2;
+    aBufSize |= aBufSize >> 4;
+    aBufSize |= aBufSize >> 8;
+    aBufSize |= aBufSize >> 16;
+    aBufSize++;
+  }
 
   const uint32_t minBufSize = kMinBufSize;
   const uint32_t maxBufSize = kChunkSize;
@@ -350,7 +353,8 @@ nsresult CacheFileChunk::Read(CacheFileHandle* aHandle, uint32_t aLen,
   mState = READING;
 
   RefPtr<CacheFileChunkBuffer> tmpBuf = new CacheFileChunkBuffer(this);
-  rv = tmpBuf->EnsureBufSize(aLen);
+  // The length of the data on the disk is known, don't round the buffer up.
+  rv = tmpBuf->EnsureBufSize(aLen, true);
   if (NS_FAILED(rv)) {
     SetError(rv);
     return mStatus;
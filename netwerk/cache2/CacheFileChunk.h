@@ -27,7 +27,11 @@ class CacheFileChunkBuffer {
 
   explicit CacheFileChunkBuffer(CacheFileChunk* aChunk);
 
-  nsresult EnsureBufSize(uint32_t aBufSize);
+  // The buffer is grown to the nearest power of two to amortize appends,
+  // unless aExact is set. Callers that know the final size of the data (e.g.
+  // when reading a chunk from the disk) should pass aExact to avoid wasting up
+  // to half of the allocation, which is charged against the memory pool.
+  nsresult EnsureBufSize(uint32_t aBufSize, bool aExact = false);
   void CopyFrom(CacheFileChunkBuffer* aOther);
   nsresult FillInvalidRanges(CacheFileChunkBuffer* aOther,
                              CacheFileUtils::ValidityMap* aMap);
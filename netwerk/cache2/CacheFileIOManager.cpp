@@ -42,6 +42,7 @@
 
 // include files for ftruncate (or equivalent)
 #if defined(XP_UNIX)
+#  include <errno.h>
 #  include <unistd.h>
 #elif defined(XP_WIN)
 #  include <windows.h>
@@ -1878,6 +1879,43 @@ nsresult CacheFileIOManager::Read(CacheFileHandle* aHandle, int64_t aOffset,
   return NS_OK;
 }
 
+// Positional read/write helpers. On Unix these map to a single pread/pwrite
+// syscall instead of a PR_Seek64 followed by PR_Read/PR_Write, which halves
+// the number of syscalls issued on the IO thread for every chunk and metadata
+// access. Return the number of bytes transferred or -1 on failure.
+static int32_t ReadAt(PRFileDesc* aFD, int64_t aOffset, char* aBuf,
+                      int32_t aCount) {
+#if defined(XP_UNIX)
+  ssize_t bytesRead;
+  do {
+    bytesRead = pread(PR_FileDesc2NativeHandle(aFD), aBuf, aCount, aOffset);
+  } while (bytesRead == -1 && errno == EINTR);
+  return static_cast<int32_t>(bytesRead);
+#else
+  if (PR_Seek64(aFD, aOffset, PR_SEEK_SET) == -1) {
+    return -1;
+  }
+  return PR_Read(aFD, aBuf, aCount);
+#endif
+}
+
+static int32_t WriteAt(PRFileDesc* aFD, int64_t aOffset, const char* aBuf,
+                       int32_t aCount) {
+#if defined(XP_UNIX)
+  ssize_t bytesWritten;
+  do {
+    bytesWritten =
+        pwrite(PR_FileDesc2NativeHandle(aFD), aBuf, aCount, aOffset);
+  } while (bytesWritten == -1 && errno == EINTR);
+  return static_cast<int32_t>(bytesWritten);
+#else
+  if (PR_Seek64(aFD, aOffset, PR_SEEK_SET) == -1) {
+    return -1;
+  }
+  return PR_Write(aFD, aBuf, aCount);
+#endif
+}
+
 nsresult CacheFileIOManager::ReadInternal(CacheFileHandle* aHandle,
                                           int64_t aOffset, char* aBuf,
                                           int32_t aCount) {
@@ -1912,12 +1950,7 @@ nsresult CacheFileIOManager::ReadInternal(CacheFileHandle* aHandle,
     return NS_ERROR_NOT_AVAILABLE;
   }
 
-  int64_t offset = PR_Seek64(aHandle->mFD, aOffset, PR_SEEK_SET);
-  if (offset == -1) {
-    return NS_ERROR_FAILURE;
-  }
-
-  int32_t bytesRead = PR_Read(aHandle->mFD, aBuf, aCount);
+  int32_t bytesRead = ReadAt(aHandle->mFD, aOffset, aBuf, aCount);
   if (bytesRead != aCount) {
     return NS_ERROR_FAILURE;
   }
@@ -2061,12 +2094,7 @@ nsresult CacheFileIOManager::WriteInternal(CacheFileHandle* aHandle,
   // Write invalidates the entry by default
   aHandle->mInvalid = true;
 
-  int64_t offset = PR_Seek64(aHandle->mFD, aOffset, PR_SEEK_SET);
-  if (offset == -1) {
-    return NS_ERROR_FAILURE;
-  }
-
-  int32_t bytesWritten = PR_Write(aHandle->mFD, aBuf, aCount);
+  int32_t bytesWritten = WriteAt(aHandle->mFD, aOffset, aBuf, aCount);
 
   if (bytesWritten != -1) {
     uint32_t oldSizeInK = aHandle->FileSizeInK();
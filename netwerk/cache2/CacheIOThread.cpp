@@ -159,6 +159,9 @@ CacheIOThread::CacheIOThread() {
   for (auto& item : mQueueLength) {
     item = 0;
   }
+  for (auto& item : mMaxLevelWaitMs) {
+    item = 0;
+  }
 
   sSelf = this;
 }
@@ -258,6 +261,9 @@ nsresult CacheIOThread::DispatchInternal(
 
   ++mQueueLength[aLevel];
   mEventQueue[aLevel].AppendElement(runnable.forget());
+  if (mLevelPendingSince[aLevel].IsNull()) {
+    mLevelPendingSince[aLevel] = TimeStamp::Now();
+  }
   if (mLowestLevelWaiting > aLevel) mLowestLevelWaiting = aLevel;
 
   mMonitor.NotifyAll();
@@ -279,6 +285,16 @@ uint32_t CacheIOThread::QueueSize(bool highPriority) {
          mQueueLength[MANAGEMENT] + mQueueLength[OPEN] + mQueueLength[READ];
 }
 
+uint32_t CacheIOThread::QueueLength(uint32_t aLevel) {
+  MOZ_ASSERT(aLevel < LAST_LEVEL);
+  return mQueueLength[aLevel];
+}
+
+uint32_t CacheIOThread::MaxWaitTime(uint32_t aLevel) {
+  MOZ_ASSERT(aLevel < LAST_LEVEL);
+  return mMaxLevelWaitMs[aLevel];
+}
+
 bool CacheIOThread::YieldInternal() {
   if (!IsCurrentThread()) {
     NS_WARNING(
@@ -452,6 +468,23 @@ void CacheIOThread::LoopOneLevel(uint32_t aLevel) {
 
   mCurrentlyExecutingLevel = aLevel;
 
+  // Events dispatched to this level while we run are newer than the ones we
+  // have taken, let them stamp the queue afresh. If we yield, the events we
+  // give back keep their original post time, so a level that keeps getting
+  // preempted reports its whole wait and not just the time since the last
+  // yield.
+  TimeStamp takenPendingSince = mLevelPendingSince[aLevel];
+  mLevelPendingSince[aLevel] = TimeStamp();
+  if (!takenPendingSince.IsNull()) {
+    uint32_t waitMs = static_cast<uint32_t>(
+        (TimeStamp::Now() - takenPendingSince).ToMilliseconds());
+    if (waitMs > mMaxLevelWaitMs[aLevel]) {
+      LOG(("CacheIOThread::LoopOneLevel new max wait [level=%u, wait=%ums]",
+           aLevel, waitMs));
+      mMaxLevelWaitMs[aLevel] = waitMs;
+    }
+  }
+
   bool returnEvents = false;
   bool reportTelemetry = true;
 
@@ -513,6 +546,10 @@ void CacheIOThread::LoopOneLevel(uint32_t aLevel) {
     events.AppendElements(std::move(mEventQueue[aLevel]));
     // And finally move everything back to the main queue.
     mEventQueue[aLevel] = std::move(events);
+    // The returned events are older than anything dispatched meanwhile.
+    if (!takenPendingSince.IsNull()) {
+      mLevelPendingSince[aLevel] = takenPendingSince;
+    }
   }
 }
 
@@ -12,6 +12,7 @@
 #include "mozilla/Monitor.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Atomics.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/UniquePtr.h"
 
 class nsIRunnable;
@@ -67,6 +68,15 @@ class CacheIOThread final : public nsIThreadObserver {
 
   uint32_t QueueSize(bool highPriority);
 
+  // Per-level scheduling statistics, exposed through nsICacheTesting.
+  // QueueLength() returns the number of events currently pending on aLevel,
+  // MaxWaitTime() the longest time in milliseconds an event on aLevel had to
+  // wait from being posted until the thread got to it, counting any time it
+  // spent handed back after the level yielded, i.e. how badly the level has
+  // been starved by higher priority levels.
+  uint32_t QueueLength(uint32_t aLevel);
+  uint32_t MaxWaitTime(uint32_t aLevel);
+
   uint32_t EventCounter() const { return mEventCounter; }
 
   /**
@@ -125,6 +135,11 @@ class CacheIOThread final : public nsIThreadObserver {
   Atomic<int32_t> mQueueLength[LAST_LEVEL];
 
   EventQueue mEventQueue[LAST_LEVEL] MOZ_GUARDED_BY(mMonitor);
+  // When the oldest event queued on each level was posted, null when the queue
+  // is empty. Events LoopOneLevel() hands back on a yield keep this time.
+  TimeStamp mLevelPendingSince[LAST_LEVEL] MOZ_GUARDED_BY(mMonitor);
+  // The longest wait observed on each level, in milliseconds.
+  Atomic<uint32_t, Relaxed> mMaxLevelWaitMs[LAST_LEVEL];
   // Raised when nsIEventTarget.Dispatch() is called on this thread
   Atomic<bool, Relaxed> mHasXPCOMEvents{false};
   // See YieldAndRerun() above
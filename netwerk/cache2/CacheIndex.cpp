@@ -1300,6 +1300,12 @@ nsresult CacheIndex::GetEntryForEviction(bool aIgnoreEmptyEntries,
   CacheIndexRecord* foundRecord = nullptr;
   uint32_t skipped = 0;
 
+  // Looking up the handle and the forced valid table for every record we skip
+  // is expensive on large indexes, so do it only when there is any forced
+  // valid entry at all.
+  bool checkForcedValid = CacheStorageService::Self() &&
+                          CacheStorageService::Self()->HasForcedValidEntries();
+
   // find first non-forced valid and unpinned entry with the lowest frecency
   index->mFrecencyArray.SortIfNeeded(lock);
 
@@ -1315,7 +1321,7 @@ nsresult CacheIndex::GetEntryForEviction(bool aIgnoreEmptyEntries,
       continue;
     }
 
-    if (IsForcedValidEntry(&hash)) {
+    if (checkForcedValid && IsForcedValidEntry(&hash)) {
       continue;
     }
 
@@ -968,23 +968,27 @@ NS_IMETHODIMP CacheStorageService::AsyncVisitAllStorages(
 
 namespace {
 
+// The comparators below sort the pool arrays so that the entries to purge
+// first end up at the tail. The purge loops walk the arrays backwards, so a
+// purged entry is removed from the end without shifting the rest.
+
 class FrecencyComparator {
  public:
   bool Equals(CacheEntry* a, CacheEntry* b) const {
     return a->GetFrecency() == b->GetFrecency();
   }
   bool LessThan(CacheEntry* a, CacheEntry* b) const {
-    // We deliberately want to keep the '0' frecency entries at the tail of the
+    // We deliberately want to keep the '0' frecency entries at the head of the
     // aray, because these are new entries and would just slow down purging of
     // the pools based on frecency.
     if (a->GetFrecency() == 0.0 && b->GetFrecency() > 0.0) {
-      return false;
+      return true;
     }
     if (a->GetFrecency() > 0.0 && b->GetFrecency() == 0.0) {
-      return true;
+      return false;
     }
 
-    return a->GetFrecency() < b->GetFrecency();
+    return a->GetFrecency() > b->GetFrecency();
   }
 };
 
@@ -994,10 +998,21 @@ class ExpirationComparator {
     return a->GetExpirationTime() == b->GetExpirationTime();
   }
   bool LessThan(CacheEntry* a, CacheEntry* b) const {
-    return a->GetExpirationTime() < b->GetExpirationTime();
+    return a->GetExpirationTime() > b->GetExpirationTime();
   }
 };
 
+// Purges walk the arrays from the tail, so look for the entry from the back.
+bool RemoveEntryFromBack(nsTArray<RefPtr<CacheEntry>>& aArray,
+                         CacheEntry* aEntry) {
+  auto index = aArray.LastIndexOf(aEntry);
+  if (index == aArray.NoIndex) {
+    return false;
+  }
+  aArray.RemoveElementAt(index);
+  return true;
+}
+
 }  // namespace
 
 void CacheStorageService::RegisterEntry(CacheEntry* aEntry) {
@@ -1027,9 +1042,9 @@ void CacheStorageService::UnregisterEntry(CacheEntry* aEntry) {
 
   MemoryPool& pool = Pool(aEntry->IsUsingDisk());
   mozilla::DebugOnly<bool> removedFrecency =
-      pool.mFrecencyArray.RemoveElement(aEntry);
+      RemoveEntryFromBack(pool.mFrecencyArray, aEntry);
   mozilla::DebugOnly<bool> removedExpiration =
-      pool.mExpirationArray.RemoveElement(aEntry);
+      RemoveEntryFromBack(pool.mExpirationArray, aEntry);
 
   MOZ_ASSERT(mShutdown || (removedFrecency && removedExpiration));
 
@@ -1188,6 +1203,11 @@ bool CacheStorageService::IsForcedValidEntry(
   return false;
 }
 
+bool CacheStorageService::HasForcedValidEntries() {
+  mozilla::MutexAutoLock lock(mForcedValidEntriesLock);
+  return !mForcedValidEntries.IsEmpty();
+}
+
 void CacheStorageService::MarkForcedValidEntryUse(nsACString const& aContextKey,
                                                   nsACString const& aEntryKey) {
   mozilla::MutexAutoLock lock(mForcedValidEntriesLock);
@@ -1421,22 +1441,25 @@ void CacheStorageService::MemoryPool::PurgeExpired() {
 
   uint32_t const memoryLimit = Limit();
 
-  for (uint32_t i = 0;
-       mMemorySize > memoryLimit && i < mExpirationArray.Length();) {
+  for (size_t i = mExpirationArray.Length();
+       mMemorySize > memoryLimit && i > 0; --i) {
     if (CacheIOThread::YieldAndRerun()) return;
 
-    RefPtr<CacheEntry> entry = mExpirationArray[i];
+    // Purging an entry only removes entries at or after i - 1, but stay in
+    // bounds regardless.
+    i = std::min(i, mExpirationArray.Length());
+    if (!i) {
+      break;
+    }
+
+    RefPtr<CacheEntry> entry = mExpirationArray[i - 1];
 
     uint32_t expirationTime = entry->GetExpirationTime();
     if (expirationTime > 0 && expirationTime <= now &&
         entry->Purge(CacheEntry::PURGE_WHOLE)) {
       LOG(("  purged expired, entry=%p, exptime=%u (now=%u)", entry.get(),
            entry->GetExpirationTime(), now));
-      continue;
     }
-
-    // not purged, move to the next one
-    ++i;
   }
 }
 
@@ -1456,23 +1479,24 @@ void CacheStorageService::MemoryPool::PurgeByFrecency(uint32_t aWhat) {
 
   mFrecencyArray.Sort(FrecencyComparator());
 
-  for (uint32_t i = 0;
-       mMemorySize > memoryLimit && i < mFrecencyArray.Length();) {
+  for (size_t i = mFrecencyArray.Length(); mMemorySize > memoryLimit && i > 0;
+       --i) {
     if (mFrecencyArray.Length() <= kFrecencyArrayLengthLimit &&
         CacheIOThread::YieldAndRerun()) {
       LOG(("MemoryPool::PurgeByFrecency interrupted"));
       return;
     }
 
-    RefPtr<CacheEntry> entry = mFrecencyArray[i];
+    i = std::min(i, mFrecencyArray.Length());
+    if (!i) {
+      break;
+    }
+
+    RefPtr<CacheEntry> entry = mFrecencyArray[i - 1];
     if (entry->Purge(aWhat)) {
       LOG(("  abandoned (%d), entry=%p, frecency=%1.10f", aWhat, entry.get(),
            entry->GetFrecency()));
-      continue;
     }
-
-    // not purged, move to the next one
-    ++i;
   }
 
   LOG(("MemoryPool::PurgeByFrecency done"));
@@ -2366,4 +2390,36 @@ CacheStorageService::Flush(nsIObserver* aObserver) {
   return thread->Dispatch(r, CacheIOThread::WRITE);
 }
 
+NS_IMETHODIMP
+CacheStorageService::GetIOThreadQueueLength(uint32_t aLevel,
+                                            uint32_t* aLength) {
+  if (aLevel >= CacheIOThread::LAST_LEVEL) {
+    return NS_ERROR_INVALID_ARG;
+  }
+
+  RefPtr<CacheIOThread> thread = CacheFileIOManager::IOThread();
+  if (!thread) {
+    return NS_ERROR_NOT_AVAILABLE;
+  }
+
+  *aLength = thread->QueueLength(aLevel);
+  return NS_OK;
+}
+
+NS_IMETHODIMP
+CacheStorageService::GetIOThreadMaxWaitTime(uint32_t aLevel,
+                                            uint32_t* aWaitTime) {
+  if (aLevel >= CacheIOThread::LAST_LEVEL) {
+    return NS_ERROR_INVALID_ARG;
+  }
+
+  RefPtr<CacheIOThread> thread = CacheFileIOManager::IOThread();
+  if (!thread) {
+    return NS_ERROR_NOT_AVAILABLE;
+  }
+
+  *aWaitTime = thread->MaxWaitTime(aLevel);
+  return NS_OK;
+}
+
 }  // namespace mozilla::net
@@ -213,6 +213,13 @@ class CacheStorageService final : public nsICacheStorageService,
    */
   bool IsForcedValidEntry(nsACString const& aContextEntryKey);
 
+  /**
+   * Cheap check CacheIndex uses to skip the per-record handle lookup and
+   * forced-valid query while scanning for an eviction candidate when no entry
+   * has been forced valid at all (the common case).
+   */
+  bool HasForcedValidEntries();
+
  private:
   // These are helpers for telemetry monitoring of the memory pools.
   void TelemetryPrune(TimeStamp& now);
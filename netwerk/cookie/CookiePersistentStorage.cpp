@@ -10,6 +10,7 @@
 
 #include "mozilla/FileUtils.h"
 #include "mozilla/ScopeExit.h"
+#include "mozilla/StaticPrefs_network.h"
 #include "mozilla/Telemetry.h"
 #include "mozIStorageAsyncStatement.h"
 #include "mozIStorageError.h"
@@ -396,6 +397,9 @@ void CookiePersistentStorage::NotifyChangedInternal(nsISupports* aSubject,
 }
 
 void CookiePersistentStorage::RemoveAllInternal() {
+  // Everything is about to be deleted anyway.
+  mPendingInsertParams = nullptr;
+
   // clear the cookie file
   if (mDBConn) {
     nsCOMPtr<mozIStorageAsyncStatement> stmt;
@@ -420,6 +424,10 @@ void CookiePersistentStorage::HandleCorruptDB() {
                    ("HandleCorruptDB(): CookieStorage %p has mCorruptFlag %u",
                     this, mCorruptFlag));
 
+  // The rebuild writes every cookie from memory, including any inserts that
+  // are still buffered.
+  mPendingInsertParams = nullptr;
+
   // Mark the database corrupt, so the close listener can begin reconstructing
   // it.
   switch (mCorruptFlag) {
@@ -484,6 +492,8 @@ void CookiePersistentStorage::RemoveCookieFromDB(const CookieListIter& aIter) {
     return;
   }
 
+  FlushPendingInserts();
+
   nsCOMPtr<mozIStorageBindingParamsArray> paramsArray;
   mStmtDelete->NewBindingParamsArray(getter_AddRefs(paramsArray));
 
@@ -563,6 +573,8 @@ void CookiePersistentStorage::Close() {
     mThread = nullptr;
   }
 
+  FlushPendingInserts();
+
   // Cleanup cached statements before we can close anything.
   CleanupCachedStatements();
 
@@ -586,11 +598,48 @@ void CookiePersistentStorage::StoreCookie(
     return;
   }
 
-  nsCOMPtr<mozIStorageBindingParamsArray> paramsArray;
-  mStmtInsert->NewBindingParamsArray(getter_AddRefs(paramsArray));
+  uint32_t timeout = StaticPrefs::network_cookie_insertBatchTimeout();
+  if (!timeout) {
+    nsCOMPtr<mozIStorageBindingParamsArray> paramsArray;
+    mStmtInsert->NewBindingParamsArray(getter_AddRefs(paramsArray));
+
+    CookieKey key(aBaseDomain, aOriginAttributes);
+    BindCookieParameters(paramsArray, key, aCookie);
+
+    MaybeStoreCookiesToDB(paramsArray);
+    return;
+  }
+
+  // Pages that set many cookies would otherwise cost one statement execution,
+  // and one implicit transaction, per cookie. Collect the inserts and write
+  // them together once the main thread is idle.
+  bool flushNow = false;
+  if (!mPendingInsertParams) {
+    mStmtInsert->NewBindingParamsArray(getter_AddRefs(mPendingInsertParams));
+
+    RefPtr<CookiePersistentStorage> self = this;
+    nsresult rv = NS_DispatchToCurrentThreadQueue(
+        NS_NewRunnableFunction("CookiePersistentStorage::FlushPendingInserts",
+                               [self] { self->FlushPendingInserts(); }),
+        timeout, EventQueuePriority::Idle);
+    // Most likely shutting down; don't leave the cookie behind.
+    flushNow = NS_FAILED(rv);
+  }
 
   CookieKey key(aBaseDomain, aOriginAttributes);
-  BindCookieParameters(paramsArray, key, aCookie);
+  BindCookieParameters(mPendingInsertParams, key, aCookie);
+
+  if (flushNow) {
+    FlushPendingInserts();
+  }
+}
+
+void CookiePersistentStorage::FlushPendingInserts() {
+  nsCOMPtr<mozIStorageBindingParamsArray> paramsArray =
+      std::move(mPendingInsertParams);
+  if (!paramsArray || !mStmtInsert) {
+    return;
+  }
 
   MaybeStoreCookiesToDB(paramsArray);
 }
@@ -617,6 +666,8 @@ void CookiePersistentStorage::MaybeStoreCookiesToDB(
 
 void CookiePersistentStorage::StaleCookies(const nsTArray<Cookie*>& aCookieList,
                                            int64_t aCurrentTimeInUsec) {
+  FlushPendingInserts();
+
   // Create an array of parameters to bind to our update statement. Batching
   // is OK here since we're updating cookies with no interleaved operations.
   nsCOMPtr<mozIStorageBindingParamsArray> paramsArray;
@@ -692,6 +743,8 @@ void CookiePersistentStorage::DeleteFromDB(
   uint32_t length;
   aParamsArray->GetLength(&length);
   if (length) {
+    FlushPendingInserts();
+
     DebugOnly<nsresult> rv = mStmtDelete->BindParameters(aParamsArray);
     MOZ_ASSERT(NS_SUCCEEDED(rv));
 
@@ -1994,7 +2047,10 @@ nsresult CookiePersistentStorage::RunInTransaction(
   // XXX Handle the error, bug 1696130.
   Unused << NS_WARN_IF(NS_FAILED(transaction.Start()));
 
-  if (NS_FAILED(aCallback->Callback())) {
+  nsresult rv = aCallback->Callback();
+  FlushPendingInserts();
+
+  if (NS_FAILED(rv)) {
     Unused << transaction.Rollback();
     return NS_ERROR_FAILURE;
   }
@@ -113,6 +113,11 @@ class CookiePersistentStorage final : public CookieStorage {
 
   void MaybeStoreCookiesToDB(mozIStorageBindingParamsArray* aParamsArray);
 
+  // Writes out the inserts buffered by StoreCookie. Must be called before any
+  // other statement is sent to the database so that the storage thread sees
+  // writes in the order they were made.
+  void FlushPendingInserts();
+
   nsCOMPtr<nsIThread> mThread;
   nsCOMPtr<mozIStorageService> mStorageService;
   nsCOMPtr<nsIEffectiveTLDService> mTLDService;
@@ -139,6 +144,9 @@ class CookiePersistentStorage final : public CookieStorage {
   nsCOMPtr<mozIStorageAsyncStatement> mStmtDelete;
   nsCOMPtr<mozIStorageAsyncStatement> mStmtUpdate;
 
+  // Cookie inserts waiting for FlushPendingInserts().
+  nsCOMPtr<mozIStorageBindingParamsArray> mPendingInsertParams;
+
   CorruptFlag mCorruptFlag;
 
   // Various parts representing asynchronous read state. These are useful
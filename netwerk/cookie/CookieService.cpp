@@ -6,6 +6,7 @@
 
 #include "CookieCommons.h"
 #include "CookieLogging.h"
+#include "mozilla/CheckedInt.h"
 #include "mozilla/ClearOnShutdown.h"
 #include "mozilla/ContentBlockingNotifier.h"
 #include "mozilla/RefPtr.h"
@@ -129,6 +130,19 @@ namespace {
 
 void ComposeCookieString(nsTArray<Cookie*>& aCookieList,
                          nsACString& aCookieString) {
+  // Cookie headers for some sites run to several KB; compute the final length
+  // up front so the string is allocated once instead of growing per cookie.
+  CheckedUint32 length = aCookieString.Length();
+  for (Cookie* cookie : aCookieList) {
+    // "; " + name + "=" + value, an upper bound for every cookie
+    length += 3;
+    length += cookie->Name().Length();
+    length += cookie->Value().Length();
+  }
+  if (length.isValid()) {
+    Unused << aCookieString.SetCapacity(length.value(), fallible);
+  }
+
   for (Cookie* cookie : aCookieList) {
     // check if we have anything to write
     if (!cookie->Name().IsEmpty() || !cookie->Value().IsEmpty()) {
@@ -140,7 +154,9 @@ void ComposeCookieString(nsTArray<Cookie*>& aCookieList,
 
       if (!cookie->Name().IsEmpty()) {
         // we have a name and value - write both
-        aCookieString += cookie->Name() + "="_ns + cookie->Value();
+        aCookieString.Append(cookie->Name());
+        aCookieString.Append('=');
+        aCookieString.Append(cookie->Value());
       } else {
         // just write value
         aCookieString += cookie->Value();
@@ -17,6 +17,10 @@
 #  include <windns.h>
 #endif  // DNSQUERY_AVAILABLE
 
+#if defined(XP_UNIX)
+#  include <netdb.h>  // For EAI_AGAIN
+#endif
+
 #include "mozilla/ClearOnShutdown.h"
 #include "mozilla/net/DNS.h"
 #include "NativeDNSResolverOverrideParent.h"
@@ -244,6 +248,14 @@ _GetAddrInfo_Portable(const nsACString& aCanonHost, uint16_t aAddressFamily,
   if (!prai) {
     LOG("PR_GetAddrInfoByName returned null PR_GetError:%d PR_GetOSErrpr:%d",
         PR_GetError(), PR_GetOSError());
+#if defined(EAI_AGAIN)
+    // NSPR reports the getaddrinfo() error code as the OS error. EAI_AGAIN is
+    // a temporary name server failure rather than a missing name.
+    if (PR_GetError() == PR_DIRECTORY_LOOKUP_ERROR &&
+        PR_GetOSError() == EAI_AGAIN) {
+      return NS_ERROR_NET_TIMEOUT;
+    }
+#endif
     return NS_ERROR_UNKNOWN_HOST;
   }
 
@@ -301,6 +313,10 @@ bool FindAddrOverride(const nsACString& aHost, uint16_t aAddressFamily,
     return false;
   }
   AutoReadLock lock(overrideService->mLock);
+  if (overrideService->mTransientFailures.Contains(aHost)) {
+    // Overridden, but with no result: the caller reports a transient failure.
+    return true;
+  }
   auto overrides = overrideService->mOverrides.Lookup(aHost);
   if (!overrides) {
     return false;
@@ -352,6 +368,10 @@ nsresult GetAddrInfo(const nsACString& aHost, uint16_t aAddressFamily,
   // If there is an override for this host, then we synthetize a result.
   if (gOverrideService &&
       FindAddrOverride(aHost, aAddressFamily, aFlags, aAddrInfo)) {
+    if (!*aAddrInfo) {
+      LOG("Returning transient failure from NativeDNSResolverOverride");
+      return NS_ERROR_NET_TIMEOUT;
+    }
     LOG("Returning IP address from NativeDNSResolverOverride");
     return (*aAddrInfo)->Addresses().Length() ? NS_OK : NS_ERROR_UNKNOWN_HOST;
   }
@@ -456,10 +476,19 @@ NS_IMETHODIMP NativeDNSResolverOverride::SetCnameOverride(
   return NS_OK;
 }
 
+NS_IMETHODIMP NativeDNSResolverOverride::SetTransientFailureOverride(
+    const nsACString& aHost) {
+  AutoWriteLock lock(mLock);
+  mTransientFailures.Insert(aHost);
+
+  return NS_OK;
+}
+
 NS_IMETHODIMP NativeDNSResolverOverride::ClearHostOverride(
     const nsACString& aHost) {
   AutoWriteLock lock(mLock);
   mCnames.Remove(aHost);
+  mTransientFailures.Remove(aHost);
   auto overrides = mOverrides.Extract(aHost);
   if (!overrides) {
     return NS_OK;
@@ -473,6 +502,7 @@ NS_IMETHODIMP NativeDNSResolverOverride::ClearOverrides() {
   AutoWriteLock lock(mLock);
   mOverrides.Clear();
   mCnames.Clear();
+  mTransientFailures.Clear();
   return NS_OK;
 }
 
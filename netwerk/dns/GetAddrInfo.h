@@ -12,6 +12,7 @@
 #include "nsINativeDNSResolverOverride.h"
 #include "nsHashKeys.h"
 #include "nsTHashMap.h"
+#include "nsTHashSet.h"
 #include "mozilla/RWLock.h"
 #include "nsTArray.h"
 #include "prio.h"
@@ -77,6 +78,7 @@ class NativeDNSResolverOverride : public nsINativeDNSResolverOverride {
 
   nsTHashMap<nsCStringHashKey, nsTArray<NetAddr>> mOverrides;
   nsTHashMap<nsCStringHashKey, nsCString> mCnames;
+  nsTHashSet<nsCString> mTransientFailures;
 
   friend bool FindAddrOverride(const nsACString& aHost, uint16_t aAddressFamily,
                                uint16_t aFlags, AddrInfo** aAddrInfo);
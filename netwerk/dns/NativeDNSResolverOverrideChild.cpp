@@ -26,6 +26,13 @@ mozilla::ipc::IPCResult NativeDNSResolverOverrideChild::RecvSetCnameOverride(
   return IPC_OK();
 }
 
+mozilla::ipc::IPCResult
+NativeDNSResolverOverrideChild::RecvSetTransientFailureOverride(
+    const nsCString& aHost) {
+  Unused << mOverrideService->SetTransientFailureOverride(aHost);
+  return IPC_OK();
+}
+
 mozilla::ipc::IPCResult NativeDNSResolverOverrideChild::RecvClearHostOverride(
     const nsCString& aHost) {
   Unused << mOverrideService->ClearHostOverride(aHost);
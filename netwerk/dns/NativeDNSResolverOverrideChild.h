@@ -23,6 +23,8 @@ class NativeDNSResolverOverrideChild : public PNativeDNSResolverOverrideChild {
                                             const nsCString& aIPLiteral);
   mozilla::ipc::IPCResult RecvSetCnameOverride(const nsCString& aHost,
                                                const nsCString& aCNAME);
+  mozilla::ipc::IPCResult RecvSetTransientFailureOverride(
+      const nsCString& aHost);
   mozilla::ipc::IPCResult RecvClearHostOverride(const nsCString& aHost);
   mozilla::ipc::IPCResult RecvClearOverrides();
 
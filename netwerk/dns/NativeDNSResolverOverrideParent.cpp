@@ -76,6 +76,17 @@ NS_IMETHODIMP NativeDNSResolverOverrideParent::SetCnameOverride(
   return NS_OK;
 }
 
+NS_IMETHODIMP NativeDNSResolverOverrideParent::SetTransientFailureOverride(
+    const nsACString& aHost) {
+  RefPtr<NativeDNSResolverOverrideParent> self = this;
+  nsCString host(aHost);
+  auto task = [self{std::move(self)}, host]() {
+    Unused << self->SendSetTransientFailureOverride(host);
+  };
+  gIOService->CallOrWaitForSocketProcess(task);
+  return NS_OK;
+}
+
 NS_IMETHODIMP NativeDNSResolverOverrideParent::ClearHostOverride(
     const nsACString& aHost) {
   RefPtr<NativeDNSResolverOverrideParent> self = this;
@@ -809,7 +809,11 @@ void nsHostResolver::DetachCallback(
 }
 
 nsresult nsHostResolver::ConditionallyCreateThread(nsHostRecord* rec) {
-  if (mNumIdleTasks) {
+  // An idle task only decrements mNumIdleTasks once it has been woken up and
+  // reacquired the lock, so comparing against the number of pending records
+  // keeps a burst of lookups (e.g. A/AAAA and HTTPS records for several
+  // origins of a page) from being queued behind a single idle task.
+  if (mNumIdleTasks >= mQueue.PendingCount()) {
     // wake up idle tasks to process this lookup
     mIdleTaskCV.Notify();
   } else if ((mActiveTaskCount < HighThreadThreshold) ||
@@ -823,6 +827,8 @@ nsresult nsHostResolver::ConditionallyCreateThread(nsHostRecord* rec) {
     if (NS_FAILED(rv)) {
       mActiveTaskCount--;
     }
+  } else if (mNumIdleTasks) {
+    mIdleTaskCV.Notify();
   } else {
     LOG(("  Unable to find a thread for looking up host [%s].\n",
          rec->host.get()));
@@ -1301,6 +1307,15 @@ static bool different_rrset(AddrInfo* rrset1, AddrInfo* rrset2) {
   return !eq;
 }
 
+// Failures worth retrying later, as opposed to an authoritative answer that
+// the name does not exist (NXDOMAIN).
+static bool IsTransientLookupFailure(nsresult aStatus) {
+  return aStatus == NS_ERROR_NET_TIMEOUT ||
+         aStatus == NS_ERROR_NET_TIMEOUT_EXTERNAL ||
+         aStatus == NS_ERROR_NET_RESET || aStatus == NS_ERROR_NET_INTERRUPT ||
+         aStatus == NS_ERROR_CONNECTION_REFUSED || aStatus == NS_ERROR_OFFLINE;
+}
+
 void nsHostResolver::AddToEvictionQ(nsHostRecord* rec,
                                     const MutexAutoLock& aLock) {
   mQueue.AddToEvictionQ(rec, mMaxCacheEntries, mRecordDB, aLock);
@@ -1414,6 +1429,9 @@ nsHostResolver::LookupStatus nsHostResolver::CompleteLookupLocked(
     newRRSet = nullptr;
   }
 
+  // Remember this before the failure is reported as NS_ERROR_UNKNOWN_HOST.
+  bool transientFailure = IsTransientLookupFailure(status);
+
   if (addrRec->LoadResolveAgain() && (status != NS_ERROR_ABORT) &&
       type == DNSResolverType::Native) {
     LOG(("nsHostResolver record %p resolve again due to flushcache\n",
@@ -1474,6 +1492,11 @@ nsHostResolver::LookupStatus nsHostResolver::CompleteLookupLocked(
     if (addrRec->mNativeSuccess) {
       addrRec->mNativeDuration = TimeStamp::Now() - addrRec->mNativeStart;
     }
+
+    if (transientFailure) {
+      // This is the error that consumers expect.
+      status = NS_ERROR_UNKNOWN_HOST;
+    }
   }
 
   addrRec->OnCompleteLookup();
@@ -1484,7 +1507,20 @@ nsHostResolver::LookupStatus nsHostResolver::CompleteLookupLocked(
   if (!mShutdown) {
     MutexAutoLock lock(addrRec->addr_info_lock);
     RefPtr<AddrInfo> old_addr_info;
-    if (different_rrset(addrRec->addr_info, newRRSet)) {
+    bool keepStale = transientFailure && addrRec->addr_info &&
+                     StaticPrefs::network_dns_keep_stale_on_failed_renewal() &&
+                     addrRec->CheckExpiration(TimeStamp::NowLoRes()) ==
+                         nsHostRecord::EXP_GRACE;
+    if (keepStale) {
+      // The refresh of a record in its grace period failed for a transient
+      // reason. Keep serving the stale addresses and leave the expiration
+      // alone, so the record is refreshed again on the next use and dropped
+      // once it really expires. A negative answer (NXDOMAIN) is authoritative
+      // and replaces the record as usual.
+      LOG(("nsHostResolver record %p keeping stale addresses\n",
+           addrRec.get()));
+      status = NS_OK;
+    } else if (different_rrset(addrRec->addr_info, newRRSet)) {
       LOG(("nsHostResolver record %p new gencnt\n", addrRec.get()));
       old_addr_info = addrRec->addr_info;
       addrRec->addr_info = std::move(newRRSet);
@@ -1502,8 +1538,10 @@ nsHostResolver::LookupStatus nsHostResolver::CompleteLookupLocked(
       }
       old_addr_info = std::move(newRRSet);
     }
-    addrRec->negative = !addrRec->addr_info;
-    PrepareRecordExpirationAddrRecord(addrRec);
+    if (!keepStale) {
+      addrRec->negative = !addrRec->addr_info;
+      PrepareRecordExpirationAddrRecord(addrRec);
+    }
   }
 
   if (LOG_ENABLED()) {
@@ -0,0 +1,143 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Checks network.dns.keep_stale_on_failed_renewal: a record in its grace
+// period keeps its addresses when the refresh fails transiently, but is
+// replaced by a negative entry when the refresh gets NXDOMAIN.
+//
+// network.dnsCacheExpiration is 0, so a record is in its grace period as soon
+// as it is cached. Each refresh is driven by a RESOLVE_BYPASS_CACHE lookup,
+// whose callback only runs once the lookup has completed through
+// nsHostResolver::CompleteLookupLocked(), so the checks below always observe
+// the outcome of a finished refresh.
+
+"use strict";
+
+const dns = Cc["@mozilla.org/network/dns-service;1"].getService(
+  Ci.nsIDNSService
+);
+const override = Cc["@mozilla.org/network/native-dns-override;1"].getService(
+  Ci.nsINativeDNSResolverOverride
+);
+const mainThread = Services.tm.currentThread;
+
+class Listener {
+  constructor() {
+    this.promise = new Promise(resolve => {
+      this.resolve = resolve;
+    });
+  }
+  onLookupComplete(inRequest, inRecord, inStatus) {
+    this.resolve([inRecord, inStatus]);
+  }
+}
+Listener.prototype.QueryInterface = ChromeUtils.generateQI(["nsIDNSListener"]);
+
+async function resolve(host, flags = 0) {
+  let listener = new Listener();
+  dns.asyncResolve(
+    host,
+    Ci.nsIDNSService.RESOLVE_TYPE_DEFAULT,
+    flags,
+    null,
+    listener,
+    mainThread,
+    {}
+  );
+  let [record, status] = await listener.promise;
+  if (!Components.isSuccessCode(status)) {
+    return [null, status];
+  }
+  return [
+    record.QueryInterface(Ci.nsIDNSAddrRecord).getNextAddrAsString(),
+    status,
+  ];
+}
+
+function refresh(host) {
+  return resolve(host, Ci.nsIDNSService.RESOLVE_BYPASS_CACHE);
+}
+
+// Caches 1.2.3.4 for host. The record starts out in its grace period.
+async function primeGraceRecord(host) {
+  override.addIPOverride(host, "1.2.3.4");
+  let [addr] = await resolve(host);
+  Assert.equal(addr, "1.2.3.4", "initial lookup uses the override");
+}
+
+add_setup(function setup() {
+  Services.prefs.setIntPref("network.trr.mode", 5);
+  Services.prefs.setBoolPref("network.dns.get-ttl", false);
+  Services.prefs.setIntPref("network.dnsCacheExpiration", 0);
+  Services.prefs.setIntPref("network.dnsCacheExpirationGracePeriod", 60);
+  Services.prefs.setBoolPref("network.dns.keep_stale_on_failed_renewal", true);
+  dns.clearCache(true);
+
+  registerCleanupFunction(() => {
+    Services.prefs.clearUserPref("network.trr.mode");
+    Services.prefs.clearUserPref("network.dns.get-ttl");
+    Services.prefs.clearUserPref("network.dnsCacheExpiration");
+    Services.prefs.clearUserPref("network.dnsCacheExpirationGracePeriod");
+    Services.prefs.clearUserPref("network.dns.keep_stale_on_failed_renewal");
+    override.clearOverrides();
+  });
+});
+
+add_task(async function test_transient_failure_keeps_stale() {
+  const host = "stale.example.com";
+  await primeGraceRecord(host);
+
+  // The refresh times out. Its callers get the stale addresses rather than an
+  // error.
+  override.setTransientFailureOverride(host);
+  let [addr, status] = await refresh(host);
+  Assert.ok(Components.isSuccessCode(status), "failed refresh is masked");
+  Assert.equal(addr, "1.2.3.4", "failed refresh reports stale addresses");
+
+  // The cached record was not replaced either.
+  [addr, status] = await resolve(host);
+  Assert.ok(Components.isSuccessCode(status), "record is still positive");
+  Assert.equal(addr, "1.2.3.4", "stale addresses are kept");
+
+  // The cache hit above started another background refresh; wait for it so
+  // that it does not outlive the override.
+  await refresh(host);
+});
+
+add_task(async function test_transient_failure_without_pref() {
+  Services.prefs.setBoolPref(
+    "network.dns.keep_stale_on_failed_renewal",
+    false
+  );
+  const host = "nopref.example.com";
+  await primeGraceRecord(host);
+
+  override.setTransientFailureOverride(host);
+  let [addr, status] = await refresh(host);
+  Assert.equal(status, Cr.NS_ERROR_UNKNOWN_HOST, "failure is reported");
+  Assert.equal(addr, null, "no addresses without the pref");
+
+  [addr, status] = await resolve(host);
+  Assert.equal(status, Cr.NS_ERROR_UNKNOWN_HOST, "record is negative");
+  await refresh(host);
+
+  Services.prefs.setBoolPref("network.dns.keep_stale_on_failed_renewal", true);
+});
+
+add_task(async function test_nxdomain_replaces_record() {
+  const host = "nxdomain.example.com";
+  await primeGraceRecord(host);
+
+  // An override with no addresses makes the refresh fail with
+  // NS_ERROR_UNKNOWN_HOST, like an NXDOMAIN answer.
+  override.addIPOverride(host, "N/A");
+  let [addr, status] = await refresh(host);
+  Assert.equal(status, Cr.NS_ERROR_UNKNOWN_HOST, "NXDOMAIN is not masked");
+  Assert.equal(addr, null, "NXDOMAIN reports no addresses");
+
+  [addr, status] = await resolve(host);
+  Assert.equal(status, Cr.NS_ERROR_UNKNOWN_HOST, "record is negative");
+  Assert.equal(addr, null, "stale addresses are dropped");
+  await refresh(host);
+});
@@ -74,6 +74,13 @@ void ConnectionEntry::PrintDiagnostics(nsCString& log,
   log.AppendPrintf("   Coalescing Keys Length = %zu\n",
                    mCoalescingKeys.Length());
   log.AppendPrintf("   Spdy using = %d\n", mUsingSpdy);
+  log.AppendPrintf("   Dispatched = %u, on idle conns = %u\n", mDispatchCount,
+                   mIdleConnReuseCount);
+  if (mDispatchCount) {
+    log.AppendPrintf("   Pending time avg = %.2fms, max = %.2fms\n",
+                     mTotalPendingTime.ToMilliseconds() / mDispatchCount,
+                     mMaxPendingTime.ToMilliseconds());
+  }
 
   uint32_t i;
   for (i = 0; i < mActiveConns.Length(); ++i) {
@@ -765,6 +765,21 @@ void ConnectionEntry::MoveConnection(HttpConnectionBase* proxyConn,
   }
 }
 
+void ConnectionEntry::RecordDispatch(nsHttpTransaction* aTrans) {
+  ++mDispatchCount;
+
+  TimeStamp pendingTime = aTrans->GetPendingTime();
+  if (pendingTime.IsNull()) {
+    return;
+  }
+
+  TimeDuration waited = TimeStamp::Now() - pendingTime;
+  mTotalPendingTime += waited;
+  if (waited > mMaxPendingTime) {
+    mMaxPendingTime = waited;
+  }
+}
+
 HttpRetParams ConnectionEntry::GetConnectionData() {
   HttpRetParams data;
   data.host = mConnInfo->Origin();
@@ -180,6 +180,11 @@ class ConnectionEntry {
 
   void PrintDiagnostics(nsCString& log, uint32_t aMaxPersistConns);
 
+  // Called for every transaction dispatched on a connection of this entry,
+  // collects the per-origin statistics printed by PrintDiagnostics().
+  void RecordDispatch(nsHttpTransaction* aTrans);
+  void RecordIdleConnReuse() { ++mIdleConnReuseCount; }
+
   bool RestrictConnections();
 
   // Return total active connection count, which is the sum of
@@ -202,6 +207,13 @@ class ConnectionEntry {
       mDnsAndConnectSockets;  // dns resolution and half open connections
 
   PendingTransactionQueue mPendingQ;
+
+  // Dispatch statistics, see RecordDispatch().
+  uint32_t mDispatchCount = 0;
+  uint32_t mIdleConnReuseCount = 0;
+  TimeDuration mTotalPendingTime;
+  TimeDuration mMaxPendingTime;
+
   ~ConnectionEntry();
 };
 
@@ -1295,74 +1295,50 @@ void Http2Compressor::EncodeInteger(uint32_t prefixLen, uint32_t val) {
 }
 
 void Http2Compressor::HuffmanAppend(const nsCString& value) {
-  nsAutoCString buf;
-  uint8_t bitsLeft = 8;
   uint32_t length = value.Length();
-  uint32_t offset;
-  uint8_t* startByte;
+  const uint8_t* input = reinterpret_cast<const uint8_t*>(value.BeginReading());
 
+  // Sum up the code lengths first, so we know the encoded length up front
+  // and can encode directly into the output instead of a temporary buffer.
+  uint64_t totalBits = 0;
   for (uint32_t i = 0; i < length; ++i) {
-    uint8_t idx = static_cast<uint8_t>(value[i]);
-    uint8_t huffLength = HuffmanOutgoing[idx].mLength;
-    uint32_t huffValue = HuffmanOutgoing[idx].mValue;
-
-    if (bitsLeft < 8) {
-      // Fill in the least significant <bitsLeft> bits of the previous byte
-      // first
-      uint32_t val;
-      if (huffLength >= bitsLeft) {
-        val = huffValue & ~((1 << (huffLength - bitsLeft)) - 1);
-        val >>= (huffLength - bitsLeft);
-      } else {
-        val = huffValue << (bitsLeft - huffLength);
-      }
-      val &= ((1 << bitsLeft) - 1);
-      offset = buf.Length() - 1;
-      startByte = reinterpret_cast<unsigned char*>(buf.BeginWriting()) + offset;
-      *startByte = *startByte | static_cast<uint8_t>(val & 0xFF);
-      if (huffLength >= bitsLeft) {
-        huffLength -= bitsLeft;
-        bitsLeft = 8;
-      } else {
-        bitsLeft -= huffLength;
-        huffLength = 0;
-      }
-    }
+    totalBits += HuffmanOutgoing[input[i]].mLength;
+  }
+  uint32_t bufLength = static_cast<uint32_t>((totalBits + 7) / 8);
 
-    while (huffLength >= 8) {
-      uint32_t mask = ~((1 << (huffLength - 8)) - 1);
-      uint8_t val = ((huffValue & mask) >> (huffLength - 8)) & 0xFF;
-      buf.Append(reinterpret_cast<char*>(&val), 1);
-      huffLength -= 8;
-    }
+  uint32_t offset = mOutput->Length();
+  EncodeInteger(7, bufLength);
+  uint8_t* startByte =
+      reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) + offset;
+  *startByte = *startByte | 0x80;
+
+  offset = mOutput->Length();
+  mOutput->SetLength(offset + bufLength);
+  uint8_t* out =
+      reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) + offset;
 
-    if (huffLength) {
-      // Fill in the most significant <huffLength> bits of the next byte
-      bitsLeft = 8 - huffLength;
-      uint8_t val = (huffValue & ((1 << huffLength) - 1)) << bitsLeft;
-      buf.Append(reinterpret_cast<char*>(&val), 1);
+  // Codes are at most 30 bits long and fewer than 8 bits are left pending
+  // after each symbol, so a 64 bit accumulator never overflows.
+  uint64_t bits = 0;
+  uint32_t pendingBits = 0;
+  for (uint32_t i = 0; i < length; ++i) {
+    const HuffmanOutgoingEntry& entry = HuffmanOutgoing[input[i]];
+    bits = (bits << entry.mLength) | entry.mValue;
+    pendingBits += entry.mLength;
+    while (pendingBits >= 8) {
+      pendingBits -= 8;
+      *out++ = static_cast<uint8_t>(bits >> pendingBits);
     }
   }
 
-  if (bitsLeft != 8) {
-    // Pad the last <bitsLeft> bits with ones, which corresponds to the EOS
-    // encoding
-    uint8_t val = (1 << bitsLeft) - 1;
-    offset = buf.Length() - 1;
-    startByte = reinterpret_cast<unsigned char*>(buf.BeginWriting()) + offset;
-    *startByte = *startByte | val;
+  if (pendingBits) {
+    // Pad the last bits with ones, which corresponds to the EOS encoding
+    uint32_t padBits = 8 - pendingBits;
+    *out++ = static_cast<uint8_t>((bits << padBits) | ((1 << padBits) - 1));
   }
 
-  // Now we know how long our encoded string is, we can fill in our length
-  uint32_t bufLength = buf.Length();
-  offset = mOutput->Length();
-  EncodeInteger(7, bufLength);
-  startByte =
-      reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) + offset;
-  *startByte = *startByte | 0x80;
-
-  // Finally, we can add our REAL data!
-  mOutput->Append(buf);
+  MOZ_ASSERT(out == reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) +
+                        mOutput->Length());
   LOG(
       ("Http2Compressor::HuffmanAppend %p encoded %d byte original on %d "
        "bytes.\n",
@@ -313,8 +313,10 @@ void Http3Session::ProcessInput(nsIUDPSocket* socket) {
   LOG(("Http3Session::ProcessInput writer=%p [this=%p state=%d]",
        mUdpConn.get(), this, mState));
 
+  // Reuse the buffer for every datagram read in this loop.
+  nsTArray<uint8_t> data;
   while (true) {
-    nsTArray<uint8_t> data;
+    data.ClearAndRetainStorage();
     NetAddr addr{};
     // RecvWithAddr actually does not return an error.
     nsresult rv = socket->RecvWithAddr(&addr, data);
@@ -734,6 +736,13 @@ nsresult Http3Session::ProcessOutput(nsIUDPSocket* socket) {
   LOG(("Http3Session::ProcessOutput reader=%p, [this=%p]", mUdpConn.get(),
        this));
 
+  // All packets of a connection normally go to the same peer, so only parse
+  // the address when it changes.
+  nsAutoCString lastRemoteAddrStr;
+  uint16_t lastPort = 0;
+  bool haveAddr = false;
+  NetAddr addr;
+
   // Check if we have a packet that could not have been sent in a previous
   // iteration or maybe get new packets to send.
   while (true) {
@@ -754,9 +763,15 @@ nsresult Http3Session::ProcessOutput(nsIUDPSocket* socket) {
          PromiseFlatCString(remoteAddrStr).get(), port, this));
 
     uint32_t written = 0;
-    NetAddr addr;
-    if (NS_FAILED(StringAndPortToNetAddr(remoteAddrStr, port, &addr))) {
-      continue;
+    if (!haveAddr || port != lastPort ||
+        !remoteAddrStr.Equals(lastRemoteAddrStr)) {
+      haveAddr =
+          NS_SUCCEEDED(StringAndPortToNetAddr(remoteAddrStr, port, &addr));
+      if (!haveAddr) {
+        continue;
+      }
+      lastRemoteAddrStr = remoteAddrStr;
+      lastPort = port;
     }
     nsresult rv = socket->SendWithAddress(&addr, packetToSend, &written);
     LOG(("Http3Session::ProcessOutput sending packet rv=%d",
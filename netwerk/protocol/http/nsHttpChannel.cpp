@@ -3762,6 +3762,12 @@ nsHttpChannel::OnCacheEntryCheck(nsICacheEntry* entry, uint32_t* aResult) {
     rv = CheckPartial(entry, &size, &contentLength);
     NS_ENSURE_SUCCESS(rv, rv);
 
+    // Concurrent identical requests are coalesced here: CacheEntry holds back
+    // every other opener while the first channel is fetching the response
+    // head, so by the time we get here another channel is already writing the
+    // body from a single network fetch. We either read along with that writer
+    // (concurrent cache access) or wait for the write to finish; neither path
+    // creates a second transaction.
     if (size == int64_t(-1)) {
       LOG(("  write is in progress"));
       if (mLoadFlags & LOAD_BYPASS_LOCAL_CACHE_IF_BUSY) {
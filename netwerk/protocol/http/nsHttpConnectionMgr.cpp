@@ -1520,6 +1520,7 @@ nsresult nsHttpConnectionMgr::TryDispatchTransactionOnIdleConn(
     ent->InsertIntoActiveConns(conn);
     nsresult rv = DispatchTransaction(ent, trans, conn);
     NS_ENSURE_SUCCESS(rv, rv);
+    ent->RecordIdleConnReuse();
 
     return NS_OK;
   }
@@ -1565,6 +1566,9 @@ nsresult nsHttpConnectionMgr::DispatchTransaction(ConnectionEntry* ent,
          "Connection host = %s\n",
          trans->ConnectionInfo()->Origin(), conn->ConnectionInfo()->Origin()));
     rv = conn->Activate(trans, caps, priority);
+    if (NS_SUCCEEDED(rv)) {
+      ent->RecordDispatch(trans);
+    }
     if (NS_SUCCEEDED(rv) && !trans->GetPendingTime().IsNull()) {
       if (conn->UsingSpdy()) {
         httpVersionkey = "h2"_ns;
@@ -1586,6 +1590,9 @@ nsresult nsHttpConnectionMgr::DispatchTransaction(ConnectionEntry* ent,
 
   rv = DispatchAbstractTransaction(ent, trans, caps, conn, priority);
 
+  if (NS_SUCCEEDED(rv)) {
+    ent->RecordDispatch(trans);
+  }
   if (NS_SUCCEEDED(rv) && !trans->GetPendingTime().IsNull()) {
     AccumulateTimeDelta(Telemetry::TRANSACTION_WAIT_TIME_HTTP,
                         trans->GetPendingTime(), TimeStamp::Now());
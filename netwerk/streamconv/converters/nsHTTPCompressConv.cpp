@@ -47,6 +47,10 @@ class BrotliWrapper {
   nsIRequest* mRequest{nullptr};
   nsISupports* mContext{nullptr};
   uint64_t mSourceOffset{0};
+
+  // Decompression output buffer, allocated on first use and kept for the
+  // lifetime of the stream rather than once per input segment.
+  UniquePtr<uint8_t[]> mOutBuffer;
 };
 
 // nsISupports implementation
@@ -200,14 +204,17 @@ nsresult nsHTTPCompressConv::BrotliHandler(nsIInputStream* stream,
     return NS_OK;
   }
 
-  auto outBuffer = MakeUniqueFallible<uint8_t[]>(kOutSize);
-  if (outBuffer == nullptr) {
-    self->mBrotli->mStatus = NS_ERROR_OUT_OF_MEMORY;
-    return self->mBrotli->mStatus;
+  if (!self->mBrotli->mOutBuffer) {
+    self->mBrotli->mOutBuffer = MakeUniqueFallible<uint8_t[]>(kOutSize);
+    if (!self->mBrotli->mOutBuffer) {
+      self->mBrotli->mStatus = NS_ERROR_OUT_OF_MEMORY;
+      return self->mBrotli->mStatus;
+    }
   }
+  uint8_t* outBuffer = self->mBrotli->mOutBuffer.get();
   do {
     outSize = kOutSize;
-    outPtr = outBuffer.get();
+    outPtr = outBuffer;
 
     // brotli api is documented in brotli/dec/decode.h and brotli/dec/decode.c
     LOG(("nsHttpCompresssConv %p brotlihandler decompress %zu\n", self, avail));
@@ -257,7 +264,7 @@ nsresult nsHTTPCompressConv::BrotliHandler(nsIInputStream* stream,
     if (outSize > 0) {
       if (NS_FAILED(callOnDataAvailable(
               self->mBrotli->mSourceOffset,
-              reinterpret_cast<const char*>(outBuffer.get()), outSize))) {
+              reinterpret_cast<const char*>(outBuffer), outSize))) {
         return self->mBrotli->mStatus;
       }
     }
@@ -57,6 +57,46 @@ TEST(TestBufferedInputStream, SimpleReadSegments)
   ASSERT_TRUE(nsCString(buf.get(), kBufSize).Equals(nsCString(buf2, count)));
 }
 
+// Reads larger than the buffer, mixed with small ones, return the data in
+// order and keep Tell() in sync.
+TEST(TestBufferedInputStream, LargeReadBypassesBuffer)
+{
+  const size_t kDataSize = 64;
+  const uint32_t kBisSize = 8;
+
+  nsCString buf;
+  buf.SetLength(kDataSize);
+  for (uint32_t i = 0; i < kDataSize; ++i) {
+    buf.BeginWriting()[i] = char(i);
+  }
+
+  nsCOMPtr<nsIInputStream> stream = new testing::AsyncStringStream(buf);
+  RefPtr<nsBufferedInputStream> bis = new nsBufferedInputStream();
+  ASSERT_EQ(NS_OK, bis->Init(stream, kBisSize));
+
+  nsCString result;
+  char chunk[kDataSize];
+  const uint32_t kReadSizes[] = {3, 20, kBisSize, 1, 32};
+  for (uint32_t size : kReadSizes) {
+    uint32_t count;
+    ASSERT_EQ(NS_OK, bis->Read(chunk, size, &count));
+    ASSERT_LE(count, size);
+    result.Append(chunk, count);
+
+    int64_t pos;
+    ASSERT_EQ(NS_OK, bis->Tell(&pos));
+    ASSERT_EQ(int64_t(result.Length()), pos);
+  }
+
+  uint32_t count;
+  do {
+    ASSERT_EQ(NS_OK, bis->Read(chunk, sizeof(chunk), &count));
+    result.Append(chunk, count);
+  } while (count);
+
+  ASSERT_TRUE(buf.Equals(result));
+}
+
 // AsyncWait - sync
 TEST(TestBufferedInputStream, AsyncWait_sync)
 {
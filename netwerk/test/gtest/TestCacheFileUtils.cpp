@@ -0,0 +1,48 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gtest/gtest.h"
+
+#include "CacheFileUtils.h"
+#include "LoadContextInfo.h"
+#include "mozilla/OriginAttributes.h"
+#include "nsString.h"
+
+using namespace mozilla;
+using namespace mozilla::net;
+
+// Builds a cache entry key the way CacheEntry::HashingKey does: the load
+// context prefix, an optional '~' id enhance tag, then ':' and the URI.
+static void BuildCacheKey(nsILoadContextInfo* aInfo,
+                          const nsACString& aIdEnhance,
+                          const nsACString& aURISpec, nsACString& aKey) {
+  aKey.Truncate();
+  CacheFileUtils::AppendKeyPrefix(aInfo, aKey);
+  if (!aIdEnhance.IsEmpty()) {
+    CacheFileUtils::AppendTagWithValue(aKey, '~', aIdEnhance);
+  }
+  aKey.Append(':');
+  aKey.Append(aURISpec);
+}
+
+TEST(TestCacheFileUtils, KeyRoundTrip)
+{
+  OriginAttributes attrs;
+  attrs.mPrivateBrowsingId = 1;
+  nsCOMPtr<nsILoadContextInfo> info = GetLoadContextInfo(true, attrs);
+
+  nsAutoCString key;
+  BuildCacheKey(info, "42"_ns, "https://example.com/a?b=c"_ns, key);
+
+  nsAutoCString idEnhance, uriSpec;
+  nsCOMPtr<nsILoadContextInfo> parsed =
+      CacheFileUtils::ParseKey(key, &idEnhance, &uriSpec);
+  ASSERT_TRUE(parsed);
+  EXPECT_TRUE(parsed->IsAnonymous());
+  EXPECT_TRUE(parsed->IsPrivate());
+  EXPECT_TRUE(idEnhance.EqualsLiteral("42"));
+  EXPECT_TRUE(uriSpec.EqualsLiteral("https://example.com/a?b=c"));
+}
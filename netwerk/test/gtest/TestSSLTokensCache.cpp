@@ -49,14 +49,26 @@ static auto MakeTestData(const size_t aDataSize) {
   return data;
 }
 
-static void putToken(const nsACString& aKey, uint32_t aSize) {
+// Expired tokens are never returned, so the tests use expiration times in the
+// future that are still ordered by token size.
+static PRTime ExpirationBase() {
+  static const PRTime sBase = PR_Now() + 3600 * PR_USEC_PER_SEC;
+  return sBase;
+}
+
+static void putToken(const nsACString& aKey, uint32_t aSize,
+                     PRTime aExpirationTime) {
   RefPtr<CommonSocketControl> socketControl = createDummySocketControl();
   nsTArray<uint8_t> token = MakeTestData(aSize);
-  nsresult rv = mozilla::net::SSLTokensCache::Put(aKey, token.Elements(), aSize,
-                                                  socketControl, aSize);
+  nsresult rv = mozilla::net::SSLTokensCache::Put(
+      aKey, token.Elements(), aSize, socketControl, aExpirationTime);
   ASSERT_EQ(rv, NS_OK);
 }
 
+static void putToken(const nsACString& aKey, uint32_t aSize) {
+  putToken(aKey, aSize, ExpirationBase() + aSize);
+}
+
 static void getAndCheckResult(const nsACString& aKey, uint32_t aExpectedSize) {
   nsTArray<uint8_t> result;
   mozilla::net::SessionCacheInfo unused;
@@ -166,3 +178,25 @@ TEST(TestTokensCache, Eviction)
   // The one has expiration time "400" was evicted, so we get "500".
   getAndCheckResult("anon:www.example2.com:443"_ns, 500);
 }
+
+TEST(TestTokensCache, Expiration)
+{
+  mozilla::net::SSLTokensCache::Clear();
+  mozilla::Preferences::SetInt("network.ssl_tokens_cache_records_per_entry", 3);
+  mozilla::Preferences::SetInt("network.ssl_tokens_cache_capacity", 2048);
+  mozilla::Preferences::SetBool("network.ssl_tokens_cache_use_only_once",
+                                false);
+
+  putToken("anon:www.example4.com:443"_ns, 100, PR_Now() - 1);
+  putToken("anon:www.example4.com:443"_ns, 200);
+
+  // The expired token sorts first but must be skipped.
+  getAndCheckResult("anon:www.example4.com:443"_ns, 200);
+
+  putToken("anon:www.example5.com:443"_ns, 100, PR_Now() - 1);
+  nsTArray<uint8_t> result;
+  mozilla::net::SessionCacheInfo unused;
+  nsresult rv = mozilla::net::SSLTokensCache::Get(
+      "anon:www.example5.com:443"_ns, result, unused);
+  ASSERT_EQ(rv, NS_ERROR_NOT_AVAILABLE);
+}
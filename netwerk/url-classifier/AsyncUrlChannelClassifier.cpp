@@ -72,6 +72,10 @@ class URIData {
 
   const nsTArray<nsCString>& Fragments();
 
+  // SHA-256 of each entry of Fragments(), shared by every table looked up for
+  // this URI.
+  const CompletionArray& FragmentHashes();
+
   nsIURI* URI() const;
 
  private:
@@ -81,6 +85,7 @@ class URIData {
   nsCOMPtr<nsIURI> mURI;
   nsCString mURISpec;
   nsTArray<nsCString> mFragments;
+  CompletionArray mFragmentHashes;
   nsIUrlClassifierFeature::URIType mURIType;
 };
 
@@ -148,6 +153,20 @@ const nsTArray<nsCString>& URIData::Fragments() {
   return mFragments;
 }
 
+const CompletionArray& URIData::FragmentHashes() {
+  MOZ_ASSERT(!NS_IsMainThread());
+
+  const nsTArray<nsCString>& fragments = Fragments();
+  if (mFragmentHashes.Length() != fragments.Length()) {
+    nsresult rv = Classifier::HashURIFragments(fragments, mFragmentHashes);
+    if (NS_WARN_IF(NS_FAILED(rv))) {
+      mFragmentHashes.Clear();
+    }
+  }
+
+  return mFragmentHashes;
+}
+
 nsIURI* URIData::URI() const {
   MOZ_ASSERT(NS_IsMainThread());
   return mURI;
@@ -243,8 +262,12 @@ bool TableData::DoLookup(nsUrlClassifierDBServiceWorker* aWorkerClassifier) {
          this));
 
     const nsTArray<nsCString>& fragments = mURIData->Fragments();
-    nsresult rv = aWorkerClassifier->DoSingleLocalLookupWithURIFragments(
-        fragments, mTable, mResults);
+    const CompletionArray& hashes = mURIData->FragmentHashes();
+    nsresult rv = NS_ERROR_FAILURE;
+    if (hashes.Length() == fragments.Length()) {
+      rv = aWorkerClassifier->DoSingleLocalLookupWithURIFragments(
+          fragments, hashes, mTable, mResults);
+    }
     Unused << NS_WARN_IF(NS_FAILED(rv));
 
     mState = mResults.IsEmpty() ? TableData::eNoMatch : TableData::eMatch;
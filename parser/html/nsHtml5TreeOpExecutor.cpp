@@ -17,6 +17,7 @@
 #include "mozilla/Preferences.h"
 #include "mozilla/ProfilerLabels.h"
 #include "mozilla/ProfilerMarkers.h"
+#include "mozilla/ScopeExit.h"
 #include "mozilla/StaticPrefs_content.h"
 #include "mozilla/StaticPrefs_security.h"
 #include "mozilla/StaticPrefs_view_source.h"
@@ -42,6 +43,7 @@
 #include "nsIScriptGlobalObject.h"
 #include "nsIViewSourceChannel.h"
 #include "nsNetUtil.h"
+#include "nsPrintfCString.h"
 #include "xpcpublic.h"
 
 using namespace mozilla;
@@ -675,6 +677,23 @@ void nsHtml5TreeOpExecutor::RunFlushLoop() {
 
       nsHtml5TreeOperation* first = mOpQueue.Elements();
       nsHtml5TreeOperation* last = first + mOpQueue.Length() - 1;
+
+      // Record how many ops each flush performed, and how long it took, to
+      // make long parser tasks easy to attribute in profiles.
+      uint32_t performedOps = 0;
+      const TimeStamp flushStart =
+          profiler_thread_is_being_profiled_for_markers() ? TimeStamp::Now()
+                                                          : TimeStamp();
+      auto addFlushMarker = MakeScopeExit([&] {
+        if (!flushStart.IsNull()) {
+          PROFILER_MARKER_TEXT(
+              "HTML tree op flush", DOM,
+              MarkerTiming::IntervalUntilNowFrom(flushStart),
+              nsPrintfCString("%" PRIu32 " of %zu ops", performedOps,
+                              size_t(last - first) + 1));
+        }
+      });
+
       for (nsHtml5TreeOperation* iter = first;; ++iter) {
         if (MOZ_UNLIKELY(!mParser)) {
           // The previous tree op caused a call to nsIParser::Terminate().
@@ -684,6 +703,7 @@ void nsHtml5TreeOpExecutor::RunFlushLoop() {
                    "Tried to perform tree op outside update batch.");
         nsresult rv =
             iter->Perform(this, &scriptElement, &interrupted, &streamEnded);
+        performedOps++;
         if (NS_FAILED(rv)) {
           MarkAsBroken(rv);
           break;
@@ -8,6 +8,7 @@
 #include "mozAutoDocUpdate.h"
 #include "mozilla/CycleCollectedJSContext.h"
 #include "mozilla/Likely.h"
+#include "mozilla/Unused.h"
 #include "mozilla/dom/Comment.h"
 #include "mozilla/dom/CustomElementRegistry.h"
 #include "mozilla/dom/DocumentType.h"
@@ -405,6 +406,7 @@ nsresult nsHtml5TreeOperation::AddAttributes(nsIContent* aNode,
 void nsHtml5TreeOperation::SetHTMLElementAttributes(
     dom::Element* aElement, nsAtom* aName, nsHtml5HtmlAttributes* aAttributes) {
   int32_t len = aAttributes->getLength();
+  Unused << aElement->EnsureAttrCapacity(len);
   for (int32_t i = 0; i < len; i++) {
     nsHtml5String val = aAttributes->getValueNoBoundsCheck(i);
     nsAtom* klass = val.MaybeAsAtom();
@@ -571,6 +573,7 @@ nsIContent* nsHtml5TreeOperation::CreateSVGElement(
   }
 
   int32_t len = aAttributes->getLength();
+  Unused << newContent->EnsureAttrCapacity(len);
   for (int32_t i = 0; i < len; i++) {
     nsHtml5String val = aAttributes->getValueNoBoundsCheck(i);
     nsAtom* klass = val.MaybeAsAtom();
@@ -619,6 +622,7 @@ nsIContent* nsHtml5TreeOperation::CreateMathMLElement(
   }
 
   int32_t len = aAttributes->getLength();
+  Unused << newContent->EnsureAttrCapacity(len);
   for (int32_t i = 0; i < len; i++) {
     nsHtml5String val = aAttributes->getValueNoBoundsCheck(i);
     nsAtom* klass = val.MaybeAsAtom();
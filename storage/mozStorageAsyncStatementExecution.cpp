@@ -136,10 +136,11 @@ bool AsyncExecuteStatements::bindExecuteAndProcessStatement(
   BindingParamsArray::iterator itr = paramsArray->begin();
   BindingParamsArray::iterator end = paramsArray->end();
   while (itr != end && continueProcessing) {
-    // Bind the data to our statement.
-    nsCOMPtr<IStorageBindingParamsInternal> bindingInternal =
-        do_QueryInterface(*itr);
-    nsCOMPtr<mozIStorageError> error = bindingInternal->bind(aStatement);
+    // Bind the data to our statement. BindingParamsArray::AddParams only
+    // accepts BindingParams it created itself, so there is no need to
+    // QueryInterface (and refcount) every row of a large batch.
+    nsCOMPtr<mozIStorageError> error =
+        static_cast<BindingParams*>(*itr)->bind(aStatement);
     if (error) {
       // Set our error state.
       mState = ERROR;
@@ -875,6 +875,14 @@ nsresult Connection::initializeInternal() {
     return convertResultCode(srv);
   }
 
+  if (uint32_t mmapSizeKiB = StaticPrefs::storage_sqlite_mmap_size_kib()) {
+    nsAutoCString mmapSizeQuery(MOZ_STORAGE_UNIQUIFY_QUERY_STR
+                                "PRAGMA mmap_size = ");
+    mmapSizeQuery.AppendInt(int64_t(mmapSizeKiB) * 1024);
+    // Not fatal: SQLite just keeps using read() if it can't map the file.
+    Unused << executeSql(mDBConn, mmapSizeQuery.get());
+  }
+
   // Register our built-in SQL functions.
   srv = registerFunctions(mDBConn);
   if (srv != SQLITE_OK) {
@@ -1612,12 +1620,15 @@ nsresult Connection::initializeClone(Connection* aClone, bool aReadOnly) {
   // schema ("main" and any other attached databases), and this implmentation
   // fails to propagate them.  This is being addressed on trunk.
   static const char* pragmas[] = {
-      "cache_size",  "temp_store",         "foreign_keys", "journal_size_limit",
-      "synchronous", "wal_autocheckpoint", "busy_timeout"};
+      "cache_size",         "temp_store",   "foreign_keys",
+      "journal_size_limit", "synchronous",  "wal_autocheckpoint",
+      "busy_timeout",       "mmap_size"};
   for (auto& pragma : pragmas) {
-    // Read-only connections just need cache_size and temp_store pragmas.
+    // Read-only connections just need the cache_size, temp_store and
+    // mmap_size pragmas.
     if (aReadOnly && ::strcmp(pragma, "cache_size") != 0 &&
-        ::strcmp(pragma, "temp_store") != 0) {
+        ::strcmp(pragma, "temp_store") != 0 &&
+        ::strcmp(pragma, "mmap_size") != 0) {
       continue;
     }
 
@@ -1629,7 +1640,8 @@ nsresult Connection::initializeClone(Connection* aClone, bool aReadOnly) {
     bool hasResult = false;
     if (stmt && NS_SUCCEEDED(stmt->ExecuteStep(&hasResult)) && hasResult) {
       pragmaQuery.AppendLiteral(" = ");
-      pragmaQuery.AppendInt(stmt->AsInt32(0));
+      // mmap_size is in bytes and can exceed the int32_t range.
+      pragmaQuery.AppendInt(stmt->AsInt64(0));
       rv = aClone->ExecuteSimpleSQL(pragmaQuery);
       MOZ_ASSERT(NS_SUCCEEDED(rv));
     }
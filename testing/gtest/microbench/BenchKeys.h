@@ -0,0 +1,30 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Shared inputs for the container benchmarks (HashtablesBench.cpp,
+// TArrayBench.cpp), so that they measure comparable workloads.
+
+#ifndef testing_gtest_microbench_BenchKeys_h
+#define testing_gtest_microbench_BenchKeys_h
+
+#include <stdint.h>
+
+static constexpr uint32_t kBenchEntries = 10000;
+static constexpr uint32_t kBenchRounds = 20;
+
+// Multiplicative scrambling so that consecutive indices don't produce
+// consecutive keys. The multiplier is odd, so this is a bijection on uint32_t:
+// distinct indices always give distinct keys.
+inline uint32_t BenchKey(uint32_t aIndex) { return aIndex * 2654435761u; }
+
+// Keys for a table holding the even indices only. Looking up
+// BenchLookupKey(0 .. 2 * kBenchEntries - 1) then alternates hit and miss.
+inline uint32_t BenchStoredKey(uint32_t aIndex) {
+  return BenchKey(aIndex << 1);
+}
+inline uint32_t BenchLookupKey(uint32_t aIndex) { return BenchKey(aIndex); }
+
+#endif  // testing_gtest_microbench_BenchKeys_h
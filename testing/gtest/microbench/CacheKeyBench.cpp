@@ -0,0 +1,70 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Per-lookup CPU cost of the cache2 index: every CacheIndex::HasEntry(key)
+// builds the key and hashes it with SHA1 before probing the index table, and
+// every entry read back from disk has its key parsed again. CacheIndex itself
+// needs an IO thread and an initialized on-disk index, so it is not benched
+// directly.
+
+#include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
+#include "gtest/BlackBox.h"
+
+#include "CacheFileUtils.h"
+#include "LoadContextInfo.h"
+#include "mozilla/OriginAttributes.h"
+#include "mozilla/SHA1.h"
+#include "nsPrintfCString.h"
+#include "nsString.h"
+#include "nsTArray.h"
+
+using namespace mozilla;
+using namespace mozilla::net;
+
+// Builds a cache entry key the way CacheEntry::HashingKey does for an entry
+// without an id enhance: the load context prefix, then ':' and the URI.
+static void BuildCacheKey(nsILoadContextInfo* aInfo, const nsACString& aURISpec,
+                          nsACString& aKey) {
+  aKey.Truncate();
+  CacheFileUtils::AppendKeyPrefix(aInfo, aKey);
+  aKey.Append(':');
+  aKey.Append(aURISpec);
+}
+
+MOZ_GTEST_BENCH(CacheKey, PerfHashAndParse, [] {
+  static constexpr uint32_t kKeys = 2000;
+  static constexpr uint32_t kRounds = 10;
+
+  OriginAttributes attrs;
+  attrs.mPrivateBrowsingId = 1;
+  nsCOMPtr<nsILoadContextInfo> info = GetLoadContextInfo(false, attrs);
+
+  nsTArray<nsCString> uris(kKeys);
+  for (uint32_t i = 0; i < kKeys; i++) {
+    uris.AppendElement(
+        nsPrintfCString("https://host%u.example.com/path/%u.js?v=%u", i % 64,
+                        i, i * 7));
+  }
+
+  nsAutoCString key, uriSpec;
+  for (uint32_t round = 0; round < kRounds; round++) {
+    for (const nsCString& uri : uris) {
+      BuildCacheKey(info, uri, key);
+
+      SHA1Sum sum;
+      SHA1Sum::Hash hash;
+      sum.update(key.BeginReading(), key.Length());
+      sum.finish(hash);
+      BlackBox(&hash);
+
+      nsCOMPtr<nsILoadContextInfo> parsed =
+          CacheFileUtils::ParseKey(key, nullptr, &uriSpec);
+      ASSERT_TRUE(parsed);
+      ASSERT_TRUE(uriSpec.Equals(uri));
+    }
+  }
+});
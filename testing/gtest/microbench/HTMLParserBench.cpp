@@ -0,0 +1,44 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Throughput of the HTML5 parser (tokenizer and tree builder) on a large,
+// tag- and entity-heavy document, parsed through DOMParser.
+
+#include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
+
+#include "mozilla/ErrorResult.h"
+#include "mozilla/dom/DOMParser.h"
+#include "mozilla/dom/Document.h"
+#include "nsCOMPtr.h"
+#include "nsString.h"
+
+MOZ_GTEST_BENCH(HTMLParser, PerfParseFromString, [] {
+  static constexpr uint32_t kRows = 2000;
+  static constexpr uint32_t kRounds = 10;
+
+  nsAutoString html;
+  html.AssignLiteral(u"<!DOCTYPE html><html><head><title>t</title></head>"
+                     u"<body>");
+  for (uint32_t i = 0; i < kRows; i++) {
+    html.AppendLiteral(
+        u"<div class=\"row\" data-i=\"1\"><p>Some <b>bold</b> and "
+        u"<i>italic</i> text &amp; an <a href=\"/x?a=1&b=2\">entity</a>."
+        u"</p><ul><li>one<li>two</ul><!-- comment --></div>\n");
+  }
+  html.AppendLiteral(u"</body></html>");
+
+  for (uint32_t round = 0; round < kRounds; round++) {
+    mozilla::IgnoredErrorResult rv;
+    RefPtr<mozilla::dom::DOMParser> parser =
+        mozilla::dom::DOMParser::CreateWithoutGlobal(rv);
+    ASSERT_FALSE(rv.Failed());
+    nsCOMPtr<mozilla::dom::Document> document = parser->ParseFromString(
+        html, mozilla::dom::SupportedType::Text_html, rv);
+    ASSERT_FALSE(rv.Failed());
+    ASSERT_TRUE(document);
+  }
+});
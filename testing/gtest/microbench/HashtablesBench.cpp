@@ -0,0 +1,94 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Benchmarks comparing nsTHashMap (backed by PLDHashTable) with
+// mozilla::HashMap for the insert and lookup patterns of our hot hash tables.
+
+#include "mozilla/HashTable.h"
+#include "nsHashKeys.h"
+#include "nsTHashMap.h"
+#include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
+#include "gtest/BlackBox.h"
+#include "BenchKeys.h"
+
+using mozilla::BlackBox;
+
+MOZ_GTEST_BENCH(Hashtables, PerfTHashMapInsert, [] {
+  for (uint32_t round = 0; round < kBenchRounds; round++) {
+    nsTHashMap<nsUint32HashKey, uint32_t> map;
+    for (uint32_t i = 0; i < kBenchEntries; i++) {
+      map.InsertOrUpdate(BenchKey(i), i);
+    }
+    BlackBox(&map);
+  }
+});
+
+MOZ_GTEST_BENCH(Hashtables, PerfHashMapInsert, [] {
+  for (uint32_t round = 0; round < kBenchRounds; round++) {
+    mozilla::HashMap<uint32_t, uint32_t> map;
+    for (uint32_t i = 0; i < kBenchEntries; i++) {
+      ASSERT_TRUE(map.put(BenchKey(i), i));
+    }
+    BlackBox(&map);
+  }
+});
+
+MOZ_GTEST_BENCH(Hashtables, PerfTHashMapLookup, [] {
+  nsTHashMap<nsUint32HashKey, uint32_t> map;
+  for (uint32_t i = 0; i < kBenchEntries; i++) {
+    map.InsertOrUpdate(BenchStoredKey(i), i);
+  }
+  // Alternate hits and misses, as atom and property lookups do.
+  uint32_t found = 0;
+  for (uint32_t round = 0; round < kBenchRounds; round++) {
+    for (uint32_t i = 0; i < 2 * kBenchEntries; i++) {
+      found += map.Contains(BenchLookupKey(*BlackBox(&i)));
+    }
+  }
+  ASSERT_EQ(found, kBenchEntries * kBenchRounds);
+});
+
+MOZ_GTEST_BENCH(Hashtables, PerfHashMapLookup, [] {
+  mozilla::HashMap<uint32_t, uint32_t> map;
+  for (uint32_t i = 0; i < kBenchEntries; i++) {
+    ASSERT_TRUE(map.put(BenchStoredKey(i), i));
+  }
+  // Same interleaved hit/miss pattern as PerfTHashMapLookup.
+  uint32_t found = 0;
+  for (uint32_t round = 0; round < kBenchRounds; round++) {
+    for (uint32_t i = 0; i < 2 * kBenchEntries; i++) {
+      found += map.has(BenchLookupKey(*BlackBox(&i)));
+    }
+  }
+  ASSERT_EQ(found, kBenchEntries * kBenchRounds);
+});
+
+MOZ_GTEST_BENCH(Hashtables, PerfTHashMapRemove, [] {
+  for (uint32_t round = 0; round < kBenchRounds; round++) {
+    nsTHashMap<nsUint32HashKey, uint32_t> map;
+    for (uint32_t i = 0; i < kBenchEntries; i++) {
+      map.InsertOrUpdate(BenchKey(i), i);
+    }
+    for (uint32_t i = 0; i < kBenchEntries; i++) {
+      map.Remove(BenchKey(i));
+    }
+    ASSERT_EQ(map.Count(), 0u);
+  }
+});
+
+MOZ_GTEST_BENCH(Hashtables, PerfHashMapRemove, [] {
+  for (uint32_t round = 0; round < kBenchRounds; round++) {
+    mozilla::HashMap<uint32_t, uint32_t> map;
+    for (uint32_t i = 0; i < kBenchEntries; i++) {
+      ASSERT_TRUE(map.put(BenchKey(i), i));
+    }
+    for (uint32_t i = 0; i < kBenchEntries; i++) {
+      map.remove(BenchKey(i));
+    }
+    ASSERT_EQ(map.count(), 0u);
+  }
+});
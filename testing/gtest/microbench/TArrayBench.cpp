@@ -0,0 +1,61 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Benchmarks for the nsTArray operations that dominate our hot paths:
+// appending, sorted insertion and lookup, and bulk removal.
+
+#include "nsTArray.h"
+#include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
+#include "gtest/BlackBox.h"
+#include "BenchKeys.h"
+
+using mozilla::BlackBox;
+
+MOZ_GTEST_BENCH(TArray, PerfAppendElement, [] {
+  for (uint32_t round = 0; round < kBenchRounds; round++) {
+    nsTArray<uint32_t> array;
+    for (uint32_t i = 0; i < kBenchEntries; i++) {
+      array.AppendElement(i);
+    }
+    BlackBox(&array);
+  }
+});
+
+MOZ_GTEST_BENCH(TArray, PerfInsertElementSorted, [] {
+  nsTArray<uint32_t> array;
+  for (uint32_t i = 0; i < kBenchEntries; i++) {
+    array.InsertElementSorted(BenchKey(i));
+  }
+  ASSERT_EQ(array.Length(), kBenchEntries);
+});
+
+MOZ_GTEST_BENCH(TArray, PerfBinaryIndexOf, [] {
+  nsTArray<uint32_t> array;
+  for (uint32_t i = 0; i < kBenchEntries; i++) {
+    array.AppendElement(BenchStoredKey(i));
+  }
+  array.Sort();
+  uint32_t found = 0;
+  for (uint32_t round = 0; round < kBenchRounds; round++) {
+    for (uint32_t i = 0; i < 2 * kBenchEntries; i++) {
+      found += array.BinaryIndexOf(BenchLookupKey(*BlackBox(&i))) !=
+               array.NoIndex;
+    }
+  }
+  ASSERT_EQ(found, kBenchEntries * kBenchRounds);
+});
+
+MOZ_GTEST_BENCH(TArray, PerfRemoveElementsBy, [] {
+  for (uint32_t round = 0; round < kBenchRounds; round++) {
+    nsTArray<uint32_t> array;
+    for (uint32_t i = 0; i < kBenchEntries; i++) {
+      array.AppendElement(BenchKey(i));
+    }
+    array.RemoveElementsBy([](uint32_t aValue) { return aValue & 1; });
+    BlackBox(&array);
+  }
+});
@@ -255,6 +255,30 @@ const char* GetPathAfterComponent(const char* filename,
 }  // namespace
 
 bool ThreadStackHelper::MaybeAppendDynamicStackFrame(Span<const char> aBuf) {
+  // Recursive and repeated frames often produce the same dynamic string
+  // several times in one stack. Point those frames at the copy which is
+  // already in the string buffer rather than storing it again. The buffer is
+  // small and bounded, so a linear scan is cheap enough to do while the
+  // target thread is suspended.
+  const nsTArray<int8_t>& strbuffer = mStackToFill->strbuffer();
+  for (const HangEntry& entry : mStackToFill->stack()) {
+    if (entry.type() != HangEntry::THangEntryBufOffset) {
+      continue;
+    }
+    uint32_t index = entry.get_HangEntryBufOffset().index();
+    if (strbuffer.Length() - index < aBuf.Length() + 1 ||
+        memcmp(strbuffer.Elements() + index, aBuf.Elements(), aBuf.Length()) ||
+        strbuffer[index + aBuf.Length()] != '\0') {
+      continue;
+    }
+    if (mStackToFill->stack().Capacity() <= mStackToFill->stack().Length()) {
+      return false;
+    }
+    mDesiredStackSize += 1;
+    mStackToFill->stack().AppendElement(HangEntryBufOffset(index));
+    return true;
+  }
+
   mDesiredBufferSize += aBuf.Length() + 1;
 
   if (mStackToFill->stack().Capacity() > mStackToFill->stack().Length() &&
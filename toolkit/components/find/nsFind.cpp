@@ -36,6 +36,8 @@
 #include "mozilla/intl/UnicodeProperties.h"
 #include "mozilla/StaticPrefs_browser.h"
 
+#include <array>
+
 using namespace mozilla;
 using namespace mozilla::dom;
 using namespace mozilla::unicode;
@@ -616,6 +618,34 @@ nsFind::Find(const nsAString& aPatText, nsRange* aSearchRange,
 
   const int32_t patternStart = mFindBackward ? patLen : 0;
 
+  auto FoldChar = [&](char32_t aChar) {
+    if (!mCaseSensitive) {
+      aChar = ToFoldedCase(aChar);
+    }
+    if (!mMatchDiacritics) {
+      aChar = ToNaked(aChar);
+    }
+    return aChar;
+  };
+
+  // When searching forward for a pattern that doesn't start with whitespace,
+  // runs of 1-byte text that can't start a match are skipped with a table
+  // lookup per character rather than the full matching logic below. Entire
+  // word searches need every character for word break detection.
+  bool canSkip1b = !mFindBackward && !mEntireWord;
+  std::array<bool, 256> startsMatch1b{};
+  if (canSkip1b) {
+    int32_t index = 0;
+    const char32_t firstPatChar = DecodeChar(patStr, &index);
+    if (IsSpace(firstPatChar)) {
+      canSkip1b = false;
+    } else {
+      for (uint32_t ch = 0; ch < startsMatch1b.size(); ch++) {
+        startsMatch1b[ch] = FoldChar(ch) == firstPatChar;
+      }
+    }
+  }
+
   // current offset into the pattern -- reset to beginning/end:
   int32_t pindex = patternStart;
 
@@ -783,6 +813,29 @@ nsFind::Find(const nsAString& aPatText, nsRange* aSearchRange,
       return NS_OK;
     }
 
+    if (canSkip1b && t1b && !matchAnchorNode && pindex == patternStart) {
+      int32_t limit = fragLen;
+      if (state.GetCurrentNode() == endNode) {
+        limit = std::min(limit, static_cast<int32_t>(endOffset) + 1);
+      }
+      const int32_t skipStart = findex;
+      while (findex < limit && !startsMatch1b[uint8_t(t1b[findex])]) {
+        findex++;
+      }
+      if (findex != skipStart) {
+        // Leave c as the per-character path would have.
+        c = FoldChar(CHAR_TO_UNICHAR(t1b[findex - 1]));
+        if (findex == limit) {
+          if (limit == fragLen) {
+            frag = nullptr;
+            continue;
+          }
+          DEBUG_FIND_PRINTF("Reached the end while skipping\n");
+          return NS_OK;
+        }
+      }
+    }
+
     // Save the previous character for word boundary detection
     char32_t prevChar = c;
     // The two characters we'll be comparing are c and patc. If not matching
@@ -17,6 +17,7 @@
 #include "nsPrintfCString.h"
 #include "nsNavHistory.h"
 #include "mozilla/Likely.h"
+#include "mozilla/Maybe.h"
 #include "mozilla/Utf8.h"
 #include "nsURLHelper.h"
 #include "nsVariant.h"
@@ -482,13 +483,20 @@ MatchAutoCompleteFunction::OnFunctionCall(mozIStorageValueArray* aArguments,
   // Obtain our search function.
   searchFunctionPtr searchFunction = getSearchFunction(matchBehavior);
 
-  // Clean up our URI spec and prepare it for searching.
+  // Clean up our URI spec and prepare it for searching. Unescaping may copy
+  // the spec, so only do it once a token actually has to be matched against
+  // the URL; many rows are decided by the title or tags alone.
   nsCString fixedUrlBuf;
-  nsDependentCSubstring fixedUrl =
-      fixupURISpec(url, matchBehavior, fixedUrlBuf);
-  // Limit the number of chars we search through.
-  const nsDependentCSubstring& trimmedUrl =
-      Substring(fixedUrl, 0, MAX_CHARS_TO_SEARCH_THROUGH);
+  Maybe<nsDependentCSubstring> trimmedUrl;
+  auto getTrimmedUrl = [&]() -> const nsDependentCSubstring& {
+    if (!trimmedUrl) {
+      nsDependentCSubstring fixedUrl =
+          fixupURISpec(url, matchBehavior, fixedUrlBuf);
+      // Limit the number of chars we search through.
+      trimmedUrl.emplace(Substring(fixedUrl, 0, MAX_CHARS_TO_SEARCH_THROUGH));
+    }
+    return *trimmedUrl;
+  };
 
   nsDependentCString title = getSharedUTF8String(aArguments, kArgIndexTitle);
   // Limit the number of chars we search through.
@@ -514,18 +522,18 @@ MatchAutoCompleteFunction::OnFunctionCall(mozIStorageValueArray* aArguments,
       matches = (searchFunction(token, trimmedTitle) ||
                  searchFunction(token, trimmedFallbackTitle) ||
                  searchFunction(token, tags)) &&
-                searchFunction(token, trimmedUrl);
+                searchFunction(token, getTrimmedUrl());
     } else if (HAS_BEHAVIOR(TITLE)) {
       matches = searchFunction(token, trimmedTitle) ||
                 searchFunction(token, trimmedFallbackTitle) ||
                 searchFunction(token, tags);
     } else if (HAS_BEHAVIOR(URL)) {
-      matches = searchFunction(token, trimmedUrl);
+      matches = searchFunction(token, getTrimmedUrl());
     } else {
       matches = searchFunction(token, trimmedTitle) ||
                 searchFunction(token, trimmedFallbackTitle) ||
                 searchFunction(token, tags) ||
-                searchFunction(token, trimmedUrl);
+                searchFunction(token, getTrimmedUrl());
     }
   }
 
@@ -469,10 +469,34 @@ void Classifier::TableRequest(nsACString& aResult) {
 nsresult Classifier::CheckURIFragments(
     const nsTArray<nsCString>& aSpecFragments, const nsACString& aTable,
     LookupResultArray& aResults) {
+  CompletionArray fragmentHashes;
+  nsresult rv = HashURIFragments(aSpecFragments, fragmentHashes);
+  NS_ENSURE_SUCCESS(rv, rv);
+
+  return CheckURIFragments(aSpecFragments, fragmentHashes, aTable, aResults);
+}
+
+/* static */
+nsresult Classifier::HashURIFragments(const nsTArray<nsCString>& aSpecFragments,
+                                      CompletionArray& aFragmentHashes) {
+  aFragmentHashes.SetLength(aSpecFragments.Length());
+  for (uint32_t i = 0; i < aSpecFragments.Length(); i++) {
+    nsresult rv = aFragmentHashes[i].FromPlaintext(aSpecFragments[i]);
+    NS_ENSURE_SUCCESS(rv, rv);
+  }
+
+  return NS_OK;
+}
+
+nsresult Classifier::CheckURIFragments(
+    const nsTArray<nsCString>& aSpecFragments,
+    const CompletionArray& aFragmentHashes, const nsACString& aTable,
+    LookupResultArray& aResults) {
   // A URL can form up to 30 different fragments
   MOZ_ASSERT(aSpecFragments.Length() != 0);
   MOZ_ASSERT(aSpecFragments.Length() <=
              (MAX_HOST_COMPONENTS * (MAX_PATH_COMPONENTS + 2)));
+  MOZ_ASSERT(aSpecFragments.Length() == aFragmentHashes.Length());
 
   if (LOG_ENABLED()) {
     uint32_t urlIdx = 0;
@@ -492,8 +516,7 @@ nsresult Classifier::CheckURIFragments(
 
   // Now check each lookup fragment against the entries in the DB.
   for (uint32_t i = 0; i < aSpecFragments.Length(); i++) {
-    Completion lookupHash;
-    lookupHash.FromPlaintext(aSpecFragments[i]);
+    const Completion& lookupHash = aFragmentHashes[i];
 
     bool has, confirmed;
     uint32_t matchLength;
@@ -63,6 +63,19 @@ class Classifier {
                              const nsACString& table,
                              LookupResultArray& aResults);
 
+  /**
+   * Same as above, but with the SHA-256 of each fragment already computed by
+   * |HashURIFragments|. Callers checking one URL against several tables
+   * should hash the fragments once and use this variant.
+   */
+  nsresult CheckURIFragments(const nsTArray<nsCString>& aSpecFragments,
+                             const CompletionArray& aFragmentHashes,
+                             const nsACString& table,
+                             LookupResultArray& aResults);
+
+  static nsresult HashURIFragments(const nsTArray<nsCString>& aSpecFragments,
+                                   CompletionArray& aFragmentHashes);
+
   /**
    * Asynchronously apply updates to the in-use databases. When the
    * update is complete, the caller can be notified by |aCallback|, which
@@ -170,9 +170,14 @@ class nsUrlClassifierDBService::FeatureHolder final {
     nsresult rv = LookupCache::GetLookupFragments(aSpec, &fragments);
     NS_ENSURE_SUCCESS(rv, rv);
 
+    // Every table is checked against the same hashes; compute them once.
+    CompletionArray fragmentHashes;
+    rv = Classifier::HashURIFragments(fragments, fragmentHashes);
+    NS_ENSURE_SUCCESS(rv, rv);
+
     for (TableData* tableData : mTableData) {
       rv = aWorker->DoSingleLocalLookupWithURIFragments(
-          fragments, tableData->mTable, tableData->mResults);
+          fragments, fragmentHashes, tableData->mTable, tableData->mResults);
       if (NS_WARN_IF(NS_FAILED(rv))) {
         return rv;
       }
@@ -334,6 +339,18 @@ nsresult nsUrlClassifierDBServiceWorker::QueueLookup(
 nsresult nsUrlClassifierDBServiceWorker::DoSingleLocalLookupWithURIFragments(
     const nsTArray<nsCString>& aSpecFragments, const nsACString& aTable,
     LookupResultArray& aResults) {
+  CompletionArray fragmentHashes;
+  nsresult rv = Classifier::HashURIFragments(aSpecFragments, fragmentHashes);
+  NS_ENSURE_SUCCESS(rv, rv);
+
+  return DoSingleLocalLookupWithURIFragments(aSpecFragments, fragmentHashes,
+                                             aTable, aResults);
+}
+
+nsresult nsUrlClassifierDBServiceWorker::DoSingleLocalLookupWithURIFragments(
+    const nsTArray<nsCString>& aSpecFragments,
+    const CompletionArray& aFragmentHashes, const nsACString& aTable,
+    LookupResultArray& aResults) {
   if (gShuttingDownThread) {
     return NS_ERROR_ABORT;
   }
@@ -347,8 +364,8 @@ nsresult nsUrlClassifierDBServiceWorker::DoSingleLocalLookupWithURIFragments(
     return NS_ERROR_NOT_AVAILABLE;
   }
 
-  nsresult rv =
-      mClassifier->CheckURIFragments(aSpecFragments, aTable, aResults);
+  nsresult rv = mClassifier->CheckURIFragments(aSpecFragments, aFragmentHashes,
+                                               aTable, aResults);
   if (NS_WARN_IF(NS_FAILED(rv))) {
     return rv;
   }
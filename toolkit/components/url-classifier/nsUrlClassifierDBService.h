@@ -170,6 +170,13 @@ class nsUrlClassifierDBServiceWorker final : public nsIUrlClassifierDBService {
       const nsTArray<nsCString>& aSpecFragments, const nsACString& aTable,
       LookupResultArray& aResults);
 
+  // As above, with the fragments already hashed by
+  // Classifier::HashURIFragments so that several tables can share the work.
+  nsresult DoSingleLocalLookupWithURIFragments(
+      const nsTArray<nsCString>& aSpecFragments,
+      const CompletionArray& aFragmentHashes, const nsACString& aTable,
+      LookupResultArray& aResults);
+
   // Open the DB connection
   nsresult OpenDb();
 
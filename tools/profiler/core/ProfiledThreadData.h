@@ -66,6 +66,7 @@ class ProfiledThreadData final {
     mUnregisterTime = mozilla::TimeStamp::Now();
     mBufferPositionWhenUnregistered = mozilla::Some(aBufferPosition);
     mPreviousThreadRunningTimes.Clear();
+    mHardwareCounters.Close();
   }
   mozilla::Maybe<uint64_t> BufferPositionWhenUnregistered() {
     return mBufferPositionWhenUnregistered;
@@ -111,6 +112,8 @@ class ProfiledThreadData final {
     return mPreviousThreadRunningTimes;
   }
 
+  ThreadHardwareCounters& HardwareCountersRef() { return mHardwareCounters; }
+
  private:
   // Group A:
   // The following fields are interesting for the entire lifetime of a
@@ -141,6 +144,9 @@ class ProfiledThreadData final {
   // RunningTimes at the previous sample if any, or empty.
   RunningTimes mPreviousThreadRunningTimes;
 
+  // Hardware counters, only opened when the "hwcounters" feature is active.
+  ThreadHardwareCounters mHardwareCounters;
+
   // Group C:
   // The following fields are only used once this thread has been unregistered.
 
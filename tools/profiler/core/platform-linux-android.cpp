@@ -67,6 +67,7 @@
 #include "mozilla/DebugOnly.h"
 #if defined(GP_OS_linux) || defined(GP_OS_android)
 #  include "common/linux/breakpad_getcontext.h"
+#  include <linux/perf_event.h>  // perf_event_open
 #endif
 
 #include <string.h>
@@ -290,6 +291,12 @@ void Sampler::Disable(PSLockRef aLock) {
 static void StreamMetaPlatformSampleUnits(PSLockRef aLock,
                                           SpliceableJSONWriter& aWriter) {
   aWriter.StringProperty("threadCPUDelta", "ns");
+  if (ActivePS::FeatureHardwareCounters(aLock)) {
+    aWriter.StringProperty("threadCyclesDelta", "cycles");
+    aWriter.StringProperty("threadInstructionsDelta", "instructions");
+    aWriter.StringProperty("threadCacheMissesDelta", "misses");
+    aWriter.StringProperty("threadBranchMissesDelta", "misses");
+  }
 }
 
 /* static */
@@ -315,6 +322,105 @@ bool GetCpuTimeSinceThreadStartInNs(
 }
 }  // namespace mozilla::profiler
 
+#if defined(GP_OS_linux) || defined(GP_OS_android)
+bool ThreadHardwareCounters::EnsureOpen(ProfilerThreadId aThreadId) {
+  if (mOpenAttempted) {
+    return mFds[Cycles] >= 0;
+  }
+  mOpenAttempted = true;
+
+  static constexpr uint64_t scConfigs[scCounterCount] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+  for (size_t i = 0; i < scCounterCount; ++i) {
+    perf_event_attr attr;
+    PodZero(&attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = scConfigs[i];
+    // Only count user-space events, this keeps the counters available with
+    // a kernel.perf_event_paranoid setting of up to 2.
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    mFds[i] = int(syscall(__NR_perf_event_open, &attr,
+                          pid_t(aThreadId.ToNumber()), /* cpu */ -1,
+                          /* group_fd */ i == Cycles ? -1 : mFds[Cycles],
+                          PERF_FLAG_FD_CLOEXEC));
+    if (i == Cycles && mFds[Cycles] < 0) {
+      // Without the group leader, no counters can be read.
+      LOG("ThreadHardwareCounters::EnsureOpen(%" PRIu64 ") failed: %d",
+          uint64_t(aThreadId.ToNumber()), errno);
+      return false;
+    }
+    // Other counters are optional (not all PMUs support them), `Read()` skips
+    // the ones that failed to open.
+  }
+  return true;
+}
+
+void ThreadHardwareCounters::Close() {
+  // Close members before the group leader.
+  for (size_t i = scCounterCount; i-- > 0;) {
+    if (mFds[i] >= 0) {
+      close(mFds[i]);
+      mFds[i] = -1;
+    }
+  }
+  mOpenAttempted = false;
+}
+
+void ThreadHardwareCounters::Read(RunningTimes& aRunningTimes) const {
+  // With PERF_FORMAT_GROUP, the leader returns the number of counters in the
+  // group, followed by their values in the order they were opened.
+  uint64_t buffer[1 + scCounterCount];
+  const ssize_t bytes =
+      mFds[Cycles] >= 0 ? read(mFds[Cycles], buffer, sizeof(buffer)) : -1;
+  const size_t count =
+      (bytes >= ssize_t(sizeof(uint64_t)))
+          ? std::min<size_t>(buffer[0], size_t(bytes) / sizeof(uint64_t) - 1)
+          : 0;
+
+  uint64_t values[scCounterCount];
+  bool known[scCounterCount] = {};
+  for (size_t i = 0, groupIndex = 0; i < scCounterCount; ++i) {
+    if (mFds[i] >= 0 && groupIndex < count) {
+      values[i] = buffer[1 + groupIndex++];
+      known[i] = true;
+    }
+  }
+
+#  define HARDWARE_COUNTER_STORE(counter, name)          \
+    if (known[counter]) {                                \
+      aRunningTimes.Reset##name##Delta(values[counter]); \
+    } else {                                             \
+      aRunningTimes.Clear##name##Delta();                \
+    }
+
+  HARDWARE_COUNTER_STORE(Cycles, ThreadCycles)
+  HARDWARE_COUNTER_STORE(Instructions, ThreadInstructions)
+  HARDWARE_COUNTER_STORE(CacheMisses, ThreadCacheMisses)
+  HARDWARE_COUNTER_STORE(BranchMisses, ThreadBranchMisses)
+
+#  undef HARDWARE_COUNTER_STORE
+}
+#endif  // defined(GP_OS_linux) || defined(GP_OS_android)
+
+// Read the thread's hardware counters into `aRunningTimes` if the
+// "hwcounters" feature is active, opening them on first use.
+static void ReadThreadHardwareCounters(
+    PSLockRef aLock, ProfiledThreadData& aProfiledThreadData,
+    RunningTimes& aRunningTimes) {
+  if (!ActivePS::FeatureHardwareCounters(aLock)) {
+    return;
+  }
+  ThreadHardwareCounters& counters = aProfiledThreadData.HardwareCountersRef();
+  if (counters.EnsureOpen(aProfiledThreadData.Info().ThreadId())) {
+    counters.Read(aRunningTimes);
+  }
+}
+
 static RunningTimes GetProcessRunningTimesDiff(
     PSLockRef aLock, RunningTimes& aPreviousRunningTimesToBeUpdated) {
   AUTO_PROFILER_STATS(GetProcessRunningTimes);
@@ -350,7 +456,7 @@ static RunningTimes GetThreadRunningTimesDiff(
     return emptyRunningTimes;
   }
 
-  const RunningTimes newRunningTimes = GetRunningTimesWithTightTimestamp(
+  RunningTimes newRunningTimes = GetRunningTimesWithTightTimestamp(
       [cid = *maybeCid](RunningTimes& aRunningTimes) {
         AUTO_PROFILER_STATS(GetRunningTimes_clock_gettime);
         if (timespec ts; clock_gettime(cid, &ts) == 0) {
@@ -364,6 +470,9 @@ static RunningTimes GetThreadRunningTimesDiff(
   ProfiledThreadData* profiledThreadData =
       aThreadData.GetProfiledThreadData(aLock);
   MOZ_ASSERT(profiledThreadData);
+  // Hardware counters don't need a tight timestamp, they are only compared
+  // between themselves (e.g., instructions per cycle).
+  ReadThreadHardwareCounters(aLock, *profiledThreadData, newRunningTimes);
   RunningTimes& previousRunningTimes =
       profiledThreadData->PreviousThreadRunningTimesRef();
   const RunningTimes diff = newRunningTimes - previousRunningTimes;
@@ -402,6 +511,7 @@ static void DiscardSuspendedThreadRunningTimes(
   } else {
     previousRunningTimes.ClearThreadCPUDelta();
   }
+  ReadThreadHardwareCounters(aLock, *profiledThreadData, previousRunningTimes);
 }
 
 template <typename Func>
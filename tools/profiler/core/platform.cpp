@@ -352,6 +352,10 @@ static uint32_t AvailableFeatures() {
   ProfilerFeature::ClearNoTimerResolutionChange(features);
 #endif
 
+#if !defined(GP_OS_linux) && !defined(GP_OS_android)
+  ProfilerFeature::ClearHardwareCounters(features);
+#endif
+
   return features;
 }
 
@@ -2433,6 +2437,13 @@ static void DoLULBacktrace(
 
 #endif
 
+#if defined(USE_LUL_STACKWALK) && defined(USE_FRAME_POINTER_STACK_WALK)
+// Set from MOZ_PROFILER_FP_UNWIND in profiler_init(). When true, periodic and
+// synchronous samples use the frame pointer walker instead of LUL, trading
+// completeness for much cheaper samples in frame-pointer builds.
+static bool sUseFramePointerUnwind = false;
+#endif
+
 #ifdef HAVE_NATIVE_UNWIND
 static void DoNativeBacktrace(
     const ThreadRegistration::UnlockedReaderAndAtomicRWOnThread& aThreadData,
@@ -2444,6 +2455,13 @@ static void DoNativeBacktrace(
   // ordering that matters is that LUL must precede FRAME_POINTER, because on
   // Linux they can both be present.
 #  if defined(USE_LUL_STACKWALK)
+#    if defined(USE_FRAME_POINTER_STACK_WALK)
+  if (sUseFramePointerUnwind) {
+    DoFramePointerBacktrace(aThreadData, aRegs, aNativeStack,
+                            aStackWalkControlIfSupported);
+    return;
+  }
+#    endif
   DoLULBacktrace(aThreadData, aRegs, aNativeStack,
                  aStackWalkControlIfSupported);
 #  elif defined(USE_EHABI_STACKWALK)
@@ -3604,6 +3622,10 @@ static void PrintUsage() {
       "  MOZ_PROFILER_LUL_TEST\n"
       "  If set to any value, runs LUL unit tests at startup.\n"
       "\n"
+      "  MOZ_PROFILER_FP_UNWIND\n"
+      "  If set to any value, Linux builds with frame pointers use the frame\n"
+      "  pointer walker instead of LUL for periodic samples.\n"
+      "\n"
       "  This platform %s native unwinding.\n"
       "\n",
 #if defined(HAVE_NATIVE_UNWIND)
@@ -4826,6 +4848,18 @@ void SamplerThread::SpyOnUnregisteredThreads() {
 #  error "bad platform"
 #endif
 
+#if !defined(GP_OS_linux) && !defined(GP_OS_android)
+// Hardware counters are not supported on this platform, see
+// AvailableFeatures().
+bool ThreadHardwareCounters::EnsureOpen(ProfilerThreadId aThreadId) {
+  return false;
+}
+
+void ThreadHardwareCounters::Close() {}
+
+void ThreadHardwareCounters::Read(RunningTimes& aRunningTimes) const {}
+#endif
+
 // END SamplerThread
 ////////////////////////////////////////////////////////////////////////
 
@@ -5073,6 +5107,10 @@ void profiler_init(void* aStackTop) {
     exit(0);
   }
 
+#if defined(USE_LUL_STACKWALK) && defined(USE_FRAME_POINTER_STACK_WALK)
+  sUseFramePointerUnwind = !!getenv("MOZ_PROFILER_FP_UNWIND");
+#endif
+
   SharedLibraryInfo::Initialize();
 
   uint32_t features = DefaultFeatures() & AvailableFeatures();
@@ -191,8 +191,14 @@ bool profiler_demangle_rust(const char* mangled, char* buffer, size_t len);
 }
 
 // For each running times value, call MACRO(index, name, unit, jsonProperty)
-#define PROFILER_FOR_EACH_RUNNING_TIME(MACRO) \
-  MACRO(0, ThreadCPU, Delta, threadCPUDelta)
+// The hardware counters are only recorded with the "hwcounters" feature, see
+// ThreadHardwareCounters below.
+#define PROFILER_FOR_EACH_RUNNING_TIME(MACRO)                  \
+  MACRO(0, ThreadCPU, Delta, threadCPUDelta)                   \
+  MACRO(1, ThreadCycles, Delta, threadCyclesDelta)             \
+  MACRO(2, ThreadInstructions, Delta, threadInstructionsDelta) \
+  MACRO(3, ThreadCacheMisses, Delta, threadCacheMissesDelta)   \
+  MACRO(4, ThreadBranchMisses, Delta, threadBranchMissesDelta)
 
 // This class contains all "running times" such as CPU usage measurements.
 // All measurements are listed in `PROFILER_FOR_EACH_RUNNING_TIME` above.
@@ -252,7 +258,8 @@ class RunningTimes {
                                                                       \
   constexpr mozilla::Maybe<uint64_t> GetJson##name##unit() const {    \
     if (Is##name##unit##Known()) {                                    \
-      return mozilla::Some(ConvertRawToJson(m##name##unit));          \
+      return mozilla::Some(ConvertRawToJson(mGot##name##unit,         \
+                                            m##name##unit));          \
     }                                                                 \
     return mozilla::Nothing{};                                        \
   }
@@ -303,6 +310,13 @@ class RunningTimes {
   // Platform-dependent.
   static uint64_t ConvertRawToJson(uint64_t aRawValue);
 
+  // Only the CPU time needs a platform-dependent conversion, hardware counters
+  // are already plain event counts.
+  static uint64_t ConvertRawToJson(uint32_t aKnownBit, uint64_t aRawValue) {
+    return (aKnownBit == mGotThreadCPUDelta) ? ConvertRawToJson(aRawValue)
+                                             : aRawValue;
+  }
+
   mozilla::TimeStamp mPostMeasurementTimeStamp;
 
   uint32_t mKnownBits = 0u;
@@ -376,4 +390,39 @@ struct mozilla::ProfileBufferEntryReader::Deserializer<RunningTimes> {
   }
 };
 
+// Hardware performance counters (cycles, instructions, cache misses, branch
+// misses) of one profiled thread, used by the "hwcounters" feature.
+// Only implemented on Linux, using a perf_event_open group; on other platforms
+// `Open` always fails and no counters are ever recorded.
+// Accesses are protected by the profiler state lock.
+class ThreadHardwareCounters {
+ public:
+  ThreadHardwareCounters() = default;
+  ~ThreadHardwareCounters() { Close(); }
+
+  ThreadHardwareCounters(const ThreadHardwareCounters&) = delete;
+  ThreadHardwareCounters& operator=(const ThreadHardwareCounters&) = delete;
+
+  // Try to open the counters for the given thread, only once: if that fails
+  // (e.g., no PMU in a VM, or forbidden by the perf_event_paranoid setting),
+  // later calls return false without retrying, until `Close()`.
+  bool EnsureOpen(ProfilerThreadId aThreadId);
+
+  // Close any open counters, the next `EnsureOpen()` will try again.
+  void Close();
+
+  // Store the current counter values into `aRunningTimes`, or clear them if
+  // the counters are not open or could not be read.
+  void Read(RunningTimes& aRunningTimes) const;
+
+ private:
+  enum Counter : size_t { Cycles, Instructions, CacheMisses, BranchMisses };
+  static constexpr size_t scCounterCount = 4;
+
+  // File descriptors for each counter, -1 if not open. The cycles counter is
+  // the group leader, which is used to read all counters at once.
+  int mFds[scCounterCount] = {-1, -1, -1, -1};
+  bool mOpenAttempted = false;
+};
+
 #endif /* ndef TOOLS_PLATFORM_H_ */
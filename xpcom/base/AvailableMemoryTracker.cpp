@@ -8,9 +8,9 @@
 
 #if defined(XP_WIN)
 #  include "mozilla/WindowsVersion.h"
-#  include "nsIMemoryReporter.h"
 #endif
 
+#include "nsIMemoryReporter.h"
 #include "nsIObserver.h"
 #include "nsIObserverService.h"
 #include "nsIRunnable.h"
@@ -30,6 +30,11 @@ using namespace mozilla;
 
 Atomic<uint32_t, MemoryOrdering::Relaxed> sNumLowPhysicalMemEvents;
 
+// Only touched on the main thread, by nsJemallocFreeDirtyPagesRunnable and the
+// memory reporter below.
+static uint32_t sNumMemoryPressurePurges = 0;
+static size_t sBytesPurgedOnMemoryPressure = 0;
+
 namespace {
 
 #if defined(XP_WIN)
@@ -104,7 +109,15 @@ nsJemallocFreeDirtyPagesRunnable::Run() {
   MOZ_ASSERT(NS_IsMainThread());
 
 #if defined(MOZ_MEMORY)
+  jemalloc_stats_t before, after;
+  jemalloc_stats(&before);
   jemalloc_free_dirty_pages();
+  jemalloc_stats(&after);
+
+  sNumMemoryPressurePurges++;
+  if (before.page_cache > after.page_cache) {
+    sBytesPurgedOnMemoryPressure += before.page_cache - after.page_cache;
+  }
 #endif
 
 #if defined(XP_WIN)
@@ -114,6 +127,39 @@ nsJemallocFreeDirtyPagesRunnable::Run() {
   return NS_OK;
 }
 
+/**
+ * Reports how much memory purging on memory-pressure has given back, so that
+ * about:memory and telemetry can tell whether it actually helps.
+ */
+class MemoryPressurePurgeReporter final : public nsIMemoryReporter {
+  ~MemoryPressurePurgeReporter() = default;
+
+ public:
+  NS_DECL_ISUPPORTS
+
+  NS_IMETHOD CollectReports(nsIHandleReportCallback* aHandleReport,
+                            nsISupports* aData, bool aAnonymize) override {
+    MOZ_ASSERT(NS_IsMainThread());
+    // clang-format off
+    MOZ_COLLECT_REPORT(
+      "memory-pressure/purges", KIND_OTHER, UNITS_COUNT_CUMULATIVE,
+      sNumMemoryPressurePurges,
+"Number of times dirty heap pages were purged in response to a "
+"memory-pressure event since startup.");
+
+    MOZ_COLLECT_REPORT(
+      "memory-pressure/purged-heap", KIND_OTHER, UNITS_BYTES,
+      sBytesPurgedOnMemoryPressure,
+"Total size of the dirty heap pages returned to the operating system in "
+"response to memory-pressure events since startup.");
+    // clang-format on
+
+    return NS_OK;
+  }
+};
+
+NS_IMPL_ISUPPORTS(MemoryPressurePurgeReporter, nsIMemoryReporter)
+
 #if defined(XP_WIN)
 void nsJemallocFreeDirtyPagesRunnable::OptimizeSystemHeap() {
   // HeapSetInformation exists prior to Windows 8.1, but the
@@ -184,6 +230,10 @@ void Init() {
   RefPtr<nsMemoryPressureWatcher> watcher = new nsMemoryPressureWatcher();
   watcher->Init();
 
+#if defined(MOZ_MEMORY)
+  RegisterStrongMemoryReporter(new MemoryPressurePurgeReporter());
+#endif
+
 #if defined(XP_WIN)
   RegisterLowMemoryEventsPhysicalDistinguishedAmount(
       LowMemoryEventsPhysicalDistinguishedAmount);
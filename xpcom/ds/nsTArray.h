@@ -2530,9 +2530,23 @@ auto nsTArray_Impl<E, Alloc>::RemoveElementsBy(Predicate aPredicate)
     return 0;
   }
 
+  // Kept elements are relocated a run at a time, once the next removed
+  // element (or the end of the array) is reached, rather than one by one.
+  // The destination of a run always precedes its source, and every slot in
+  // between has been destructed or relocated already, so moving the run
+  // front-to-back is valid even though the regions may overlap.
   index_type j = 0;
+  index_type runStart = 0;
   const index_type len = Length();
   value_type* const elements = Elements();
+  auto flushRun = [&](index_type aRunEnd) {
+    const index_type runLength = aRunEnd - runStart;
+    if (runLength && j < runStart) {
+      relocation_type::RelocateOverlappingRegion(
+          elements + j, elements + runStart, runLength, sizeof(value_type));
+    }
+    j += runLength;
+  };
   for (index_type i = 0; i < len; ++i) {
     const bool result = aPredicate(elements[i]);
 
@@ -2541,15 +2555,12 @@ auto nsTArray_Impl<E, Alloc>::RemoveElementsBy(Predicate aPredicate)
                           elements == Elements());
 
     if (result) {
+      flushRun(i);
+      runStart = i + 1;
       elem_traits::Destruct(elements + i);
-    } else {
-      if (j < i) {
-        relocation_type::RelocateNonOverlappingRegion(
-            elements + j, elements + i, 1, sizeof(value_type));
-      }
-      ++j;
     }
   }
+  flushRun(len);
 
   base_type::mHdr->mLength = j;
   return len - j;
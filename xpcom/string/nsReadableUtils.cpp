@@ -208,61 +208,69 @@ char16_t* CopyUnicodeTo(const nsAString& aSource, uint32_t aSrcOffset,
   return aDest;
 }
 
-void ToUpperCase(nsACString& aCString) {
+// The ASCII case conversions below are written without data-dependent
+// branches in the inner loop so that compilers can vectorize them.
+static inline char ASCIIToUpperBranchless(char aChar) {
+  return char(aChar - ((aChar >= 'a' && aChar <= 'z') ? ('a' - 'A') : 0));
+}
+
+static inline char ASCIIToLowerBranchless(char aChar) {
+  return char(aChar + ((aChar >= 'A' && aChar <= 'Z') ? ('a' - 'A') : 0));
+}
+
+// Converts aCString in place, but only calls BeginWriting() (which may have
+// to copy a shared buffer) once a character that needs changing is found.
+template <bool (*NeedsChange)(char), char (*Convert)(char)>
+static void ConvertASCIICaseInPlace(nsACString& aCString) {
+  const char* begin = aCString.BeginReading();
+  const char* end = begin + aCString.Length();
+  const char* first = std::find_if(begin, end, NeedsChange);
+  if (first == end) {
+    return;
+  }
+  size_t offset = first - begin;
+  size_t length = aCString.Length();
   char* cp = aCString.BeginWriting();
-  char* end = cp + aCString.Length();
-  while (cp != end) {
-    char ch = *cp;
-    if (ch >= 'a' && ch <= 'z') {
-      *cp = ch - ('a' - 'A');
-    }
-    ++cp;
+  for (size_t i = offset; i < length; ++i) {
+    cp[i] = Convert(cp[i]);
   }
 }
 
+static bool IsASCIILowercaseChar(char aChar) {
+  return aChar >= 'a' && aChar <= 'z';
+}
+
+static bool IsASCIIUppercaseChar(char aChar) {
+  return aChar >= 'A' && aChar <= 'Z';
+}
+
+void ToUpperCase(nsACString& aCString) {
+  ConvertASCIICaseInPlace<IsASCIILowercaseChar, ASCIIToUpperBranchless>(
+      aCString);
+}
+
 void ToUpperCase(const nsACString& aSource, nsACString& aDest) {
   aDest.SetLength(aSource.Length());
   const char* src = aSource.BeginReading();
-  const char* end = src + aSource.Length();
+  const size_t length = aSource.Length();
   char* dst = aDest.BeginWriting();
-  while (src != end) {
-    char ch = *src;
-    if (ch >= 'a' && ch <= 'z') {
-      *dst = ch - ('a' - 'A');
-    } else {
-      *dst = ch;
-    }
-    ++src;
-    ++dst;
+  for (size_t i = 0; i < length; ++i) {
+    dst[i] = ASCIIToUpperBranchless(src[i]);
   }
 }
 
 void ToLowerCase(nsACString& aCString) {
-  char* cp = aCString.BeginWriting();
-  char* end = cp + aCString.Length();
-  while (cp != end) {
-    char ch = *cp;
-    if (ch >= 'A' && ch <= 'Z') {
-      *cp = ch + ('a' - 'A');
-    }
-    ++cp;
-  }
+  ConvertASCIICaseInPlace<IsASCIIUppercaseChar, ASCIIToLowerBranchless>(
+      aCString);
 }
 
 void ToLowerCase(const nsACString& aSource, nsACString& aDest) {
   aDest.SetLength(aSource.Length());
   const char* src = aSource.BeginReading();
-  const char* end = src + aSource.Length();
+  const size_t length = aSource.Length();
   char* dst = aDest.BeginWriting();
-  while (src != end) {
-    char ch = *src;
-    if (ch >= 'A' && ch <= 'Z') {
-      *dst = ch + ('a' - 'A');
-    } else {
-      *dst = ch;
-    }
-    ++src;
-    ++dst;
+  for (size_t i = 0; i < length; ++i) {
+    dst[i] = ASCIIToLowerBranchless(src[i]);
   }
 }
 
@@ -2347,6 +2347,44 @@ MOZ_GTEST_BENCH_F(Strings, PerfIsUTF8Example3, [this] {
   }
 });
 
+TEST_F(Strings, ASCIICaseConversion) {
+  nsCString upper("MIXED case 123 \xC3\x84");
+  ToUpperCase(upper);
+  EXPECT_TRUE(upper.EqualsLiteral("MIXED CASE 123 \xC3\x84"));
+
+  nsCString lower;
+  ToLowerCase(upper, lower);
+  EXPECT_TRUE(lower.EqualsLiteral("mixed case 123 \xC3\x84"));
+
+  // Converting a string that needs no change must not unshare its buffer.
+  nsCString shared(lower);
+  ToLowerCase(shared);
+  EXPECT_EQ(shared.BeginReading(), lower.BeginReading());
+
+  EXPECT_TRUE(lower.Equals(upper, nsCaseInsensitiveCStringComparator));
+  EXPECT_TRUE(lower.Equals(lower, nsCaseInsensitiveCStringComparator));
+  EXPECT_FALSE(lower.Equals("mixed case 124 \xC3\x84"_ns,
+                            nsCaseInsensitiveCStringComparator));
+}
+
+MOZ_GTEST_BENCH_F(Strings, PerfToLowerCaseExample3, [this] {
+  for (int i = 0; i < 10000; i++) {
+    nsCString lower;
+    ToLowerCase(*BlackBox(&mExample3Utf8), lower);
+    BlackBox(&lower);
+  }
+});
+
+MOZ_GTEST_BENCH_F(Strings, PerfCaseInsensitiveEqualsExample3, [this] {
+  nsCString copy(mExample3Utf8);
+  copy.BeginWriting();  // Make sure the buffers aren't shared.
+  for (int i = 0; i < 10000; i++) {
+    bool b = BlackBox(&mExample3Utf8)
+                 ->Equals(*BlackBox(&copy), nsCaseInsensitiveCStringComparator);
+    BlackBox(&b);
+  }
+});
+
 MOZ_GTEST_BENCH_F(Strings, PerfIsASCII8One, [this] {
   for (int i = 0; i < 200000; i++) {
     bool b = IsAscii(*BlackBox(&mAsciiOneUtf8));
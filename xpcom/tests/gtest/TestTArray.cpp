@@ -8,6 +8,7 @@
 #include "gtest/gtest.h"
 #include "mozilla/ArrayUtils.h"
 #include "mozilla/RefPtr.h"
+#include "nsPrintfCString.h"
 #include "nsTHashMap.h"
 
 using namespace mozilla;
@@ -1037,6 +1038,27 @@ TEST(TArray, RemoveElementsBy)
     nsTArray<int> goal{};
     EXPECT_EQ(array, goal);
   }
+
+  // Runs of kept elements are compacted correctly, also for elements that
+  // own memory.
+  {
+    nsTArray<nsCString> array;
+    for (int i = 0; i < 20; i++) {
+      array.AppendElement(nsPrintfCString("%d", i));
+    }
+    auto removed = array.RemoveElementsBy([](const nsCString& aString) {
+      return aString.EqualsLiteral("0") || aString.EqualsLiteral("3") ||
+             aString.EqualsLiteral("4") || aString.EqualsLiteral("10") ||
+             aString.EqualsLiteral("19");
+    });
+    EXPECT_EQ(removed, 5u);
+
+    nsTArray<nsCString> goal;
+    for (int i : {1, 2, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 17, 18}) {
+      goal.AppendElement(nsPrintfCString("%d", i));
+    }
+    EXPECT_EQ(array, goal);
+  }
 }
 
 }  // namespace TestTArray
@@ -26,6 +26,10 @@
 #include "prenv.h"
 #include "prsystem.h"
 
+#ifdef MOZ_MEMORY
+#  include "mozmemory.h"
+#endif
+
 namespace mozilla {
 
 std::unique_ptr<TaskController> TaskController::sSingleton;
@@ -267,6 +271,14 @@ void TaskController::ShutdownInternal() { sSingleton = nullptr; }
 void TaskController::RunPoolThread() {
   IOInterposer::RegisterCurrentThread();
 
+#ifdef MOZ_MEMORY
+  // Pool threads run allocation-heavy work (image decoding, off-main-thread
+  // parsing and compression) concurrently. Give each of them its own jemalloc
+  // arena, like Stylo and WebRender threads have, so that their small
+  // allocations don't contend on the lock of a shared arena.
+  jemalloc_thread_local_arena(true);
+#endif
+
   // This is used to hold on to a task to make sure it is released outside the
   // lock. This is required since it's perfectly feasible for task destructors
   // to post events themselves.
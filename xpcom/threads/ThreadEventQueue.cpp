@@ -131,7 +131,9 @@ bool ThreadEventQueue::PutEventInternal(already_AddRefed<nsIRunnable>&& aEvent,
       mBaseQueue->PutEvent(event.take(), aPriority, lock);
     }
 
-    mEventsAvailable.Notify();
+    if (mWaitingConsumers) {
+      mEventsAvailable.Notify();
+    }
 
     // Make sure to grab the observer before dropping the lock, otherwise the
     // event that we just placed into the queue could run and eventually delete
@@ -178,7 +180,9 @@ already_AddRefed<nsIRunnable> ThreadEventQueue::GetEvent(
       }
 
       AUTO_PROFILER_LABEL("ThreadEventQueue::GetEvent::Wait", IDLE);
+      ++mWaitingConsumers;
       mEventsAvailable.Wait();
+      --mWaitingConsumers;
     }
   }
 
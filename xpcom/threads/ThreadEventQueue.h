@@ -80,6 +80,10 @@ class ThreadEventQueue final : public SynchronizedEventQueue {
 
   Mutex mLock;
   CondVar mEventsAvailable MOZ_GUARDED_BY(mLock);
+  // Number of threads waiting on mEventsAvailable in GetEvent(). Dispatching
+  // doesn't need to signal the condvar while the consumer is busy running
+  // events, since it will check the queue again before waiting.
+  uint32_t mWaitingConsumers MOZ_GUARDED_BY(mLock) = 0;
 
   bool mEventsAreDoomed MOZ_GUARDED_BY(mLock) = false;
   nsCOMPtr<nsIThreadObserver> mObserver MOZ_GUARDED_BY(mLock);
@@ -543,7 +543,7 @@ TimerThread::Run() {
       RemoveLeadingCanceledTimersInternal();
 
       if (!mTimers.IsEmpty()) {
-        TimeStamp timeout = mTimers[0]->Value()->mTimeout;
+        TimeStamp timeout = ComputeWakeupTimeFromTimers(now);
 
         // Don't wait at all (even for PR_INTERVAL_NO_WAIT) if the next timer
         // is due now or overdue.
@@ -806,8 +806,20 @@ bool TimerThread::AddTimerInternal(nsTimerImpl* aTimer) {
 
   LogTimerEvent::LogDispatch(aTimer);
 
+  // Zero-delay timers are usually expected to run as soon as possible, so they
+  // get no tolerance.
+  TimeDuration delayTolerance;
+  if (uint32_t percent = StaticPrefs::timer_firing_delay_tolerance_percent();
+      percent && !aTimer->mDelay.IsZero()) {
+    delayTolerance = std::min(
+        aTimer->mDelay.MultDouble(percent / 100.0),
+        TimeDuration::FromMilliseconds(
+            StaticPrefs::timer_maximum_firing_delay_tolerance_ms()));
+  }
+
   UniquePtr<Entry>* entry = mTimers.AppendElement(
-      MakeUnique<Entry>(now, aTimer->mTimeout, aTimer), mozilla::fallible);
+      MakeUnique<Entry>(now, aTimer->mTimeout, delayTolerance, aTimer),
+      mozilla::fallible);
   if (!entry) {
     return false;
   }
@@ -860,6 +872,49 @@ void TimerThread::RemoveLeadingCanceledTimersInternal() {
   mTimers.RemoveLastElements(mTimers.end() - sortedEnd);
 }
 
+TimeStamp TimerThread::ComputeWakeupTimeFromTimers(const TimeStamp& aNow) {
+  mMonitor.AssertCurrentThreadOwns();
+  AUTO_TIMERS_STATS(TimerThread_ComputeWakeupTimeFromTimers);
+  MOZ_ASSERT(!mTimers.IsEmpty() && mTimers[0]->Value());
+
+  // An overdue front timer is fired right away, along with any others that
+  // are due by then.
+  TimeStamp wakeupTime = mTimers[0]->Timeout();
+  TimeStamp cutoffTime = mTimers[0]->LatestFiringTime();
+  if (wakeupTime <= aNow || cutoffTime == wakeupTime) {
+    return wakeupTime;
+  }
+
+  // Visit timers in firing order (by temporarily moving them to the back of
+  // the heap, like FindNextFireTimeForCurrentThread), and delay the wakeup to
+  // the last timer that can be fired at the same time as all the ones before
+  // it, without making any of them later than its tolerance.
+  // Only look at a few timers to bound the cost of this search.
+  static constexpr size_t kMaxTimersToVisit = 32;
+  size_t visited = 0;
+  auto end = mTimers.end();
+  while (end != mTimers.begin() && visited < kMaxTimersToVisit) {
+    const Entry& entry = *mTimers[0];
+    if (entry.Value()) {
+      if (entry.Timeout() > cutoffTime) {
+        break;
+      }
+      wakeupTime = entry.Timeout();
+      cutoffTime = std::min(cutoffTime, entry.LatestFiringTime());
+    }
+    std::pop_heap(mTimers.begin(), end, Entry::UniquePtrLessThan);
+    --end;
+    ++visited;
+  }
+
+  while (end != mTimers.end()) {
+    ++end;
+    std::push_heap(mTimers.begin(), end, Entry::UniquePtrLessThan);
+  }
+
+  return wakeupTime;
+}
+
 void TimerThread::RemoveFirstTimerInternal() {
   mMonitor.AssertCurrentThreadOwns();
   AUTO_TIMERS_STATS(TimerThread_RemoveFirstTimerInternal);
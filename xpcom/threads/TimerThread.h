@@ -71,6 +71,11 @@ class TimerThread final : public mozilla::Runnable, public nsIObserver {
       MOZ_REQUIRES(mMonitor, aTimer->mMutex);
   void RemoveLeadingCanceledTimersInternal() MOZ_REQUIRES(mMonitor);
   void RemoveFirstTimerInternal() MOZ_REQUIRES(mMonitor);
+  // Time at which to wake up to fire the front timer, possibly delayed within
+  // its firing delay tolerance so that following timers can be fired in the
+  // same wakeup. mTimers must not be empty nor start with a canceled timer.
+  TimeStamp ComputeWakeupTimeFromTimers(const TimeStamp& aNow)
+      MOZ_REQUIRES(mMonitor);
   nsresult Init() MOZ_REQUIRES(mMonitor);
 
   void PostTimerEvent(already_AddRefed<nsTimerImpl> aTimerRef)
@@ -90,14 +95,17 @@ class TimerThread final : public mozilla::Runnable, public nsIObserver {
 
   class Entry final : public nsTimerImplHolder {
     const TimeStamp mTimeout;
+    // How late this timer may fire, to coalesce wakeups.
+    const TimeDuration mDelayTolerance;
 
    public:
     // Entries are created with the TimerImpl's mutex held.
     // nsTimerImplHolder() will call SetHolder()
     Entry(const TimeStamp& aMinTimeout, const TimeStamp& aTimeout,
-          nsTimerImpl* aTimerImpl)
+          const TimeDuration& aDelayTolerance, nsTimerImpl* aTimerImpl)
         : nsTimerImplHolder(aTimerImpl),
-          mTimeout(std::max(aMinTimeout, aTimeout)) {}
+          mTimeout(std::max(aMinTimeout, aTimeout)),
+          mDelayTolerance(aDelayTolerance) {}
 
     nsTimerImpl* Value() const { return mTimerImpl; }
 
@@ -118,6 +126,7 @@ class TimerThread final : public mozilla::Runnable, public nsIObserver {
     }
 
     TimeStamp Timeout() const { return mTimeout; }
+    TimeStamp LatestFiringTime() const { return mTimeout + mDelayTolerance; }
   };
 
   nsTArray<mozilla::UniquePtr<Entry>> mTimers MOZ_GUARDED_BY(mMonitor);